@@ -174,6 +174,11 @@ enum eMP_SCHEDULING {
 	MP_SCHEDULING_INTEGRATED
 };
 
+enum eMP_MIGRATION {
+	MP_MIGRATION_SYNC = 0,
+	MP_MIGRATION_ASYNC
+};
+
 enum eVerbosity {
   VERBOSE_SILENT = 0,   // 0: No output at all
   VERBOSE_NORMAL,       // 1: Notification at start of commands.
@@ -46,12 +46,15 @@ namespace Avida {
     tArray<cInstruction> m_seq;
     int m_active_size;
     cMutationSteps m_mutation_steps;
+    mutable unsigned long long m_hash;  // cached polynomial hash of the active sites, see GetHash()
+    mutable bool m_hash_valid;
+    mutable int m_unmodified;  // sites before this position are unchanged since the last ClearModified()
     
     
   public:
-    Sequence() : m_active_size(0) { ; }
+    Sequence() : m_active_size(0), m_hash(0), m_hash_valid(false), m_unmodified(0) { ; }
     Sequence(const Sequence& seq);
-    explicit Sequence(int size) : m_seq(size), m_active_size(size) { ; }
+    explicit Sequence(int size) : m_seq(size), m_active_size(size), m_hash(0), m_hash_valid(false), m_unmodified(0) { ; }
     Sequence(const cString& str);
     virtual ~Sequence();
     
@@ -65,9 +68,37 @@ namespace Avida {
     inline cMutationSteps& GetMutationSteps() { return m_mutation_steps; }
     inline const cMutationSteps& GetMutationSteps() const { return m_mutation_steps; }
     
-    inline cInstruction& operator[](int idx) { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
+    inline cInstruction& operator[](int idx)
+      { assert(idx >= 0 && idx < m_active_size); m_hash_valid = false; siteModified(idx); return m_seq[idx]; }
     inline const cInstruction& operator[](int idx) const { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
     
+    // Replace a single site, keeping the cached hash current (writing through operator[] discards it)
+    inline void SetInst(int idx, const cInstruction& inst)
+      { assert(idx >= 0 && idx < m_active_size); hashSite(idx, m_seq[idx], inst); siteModified(idx); m_seq[idx] = inst; }
+    
+
+    // Hashing Methods
+    // --------------------------------------------------------------------------------------------------------------
+
+    // Polynomial hash, sum((op + 1) * HASH_BASE^i) over the active sites.  The value is computed on first use and then
+    // carried through assignment and copy construction, and updated in place by SetInst(), Copy() and single site
+    // Insert() and Remove().  Any other modification drops it, to be recomputed on the next call.
+    unsigned long long GetHash() const;
+    inline bool HasValidHash() const { return m_hash_valid; }
+    
+    // Derive the hash of this sequence from that of a same length ancestor, adding a delta for each differing site
+    // rather than rehashing every site.  Returns false (leaving the hash to be computed lazily) if the sizes differ.
+    bool InheritHash(const Sequence& parent);
+
+    
+    // Modification Tracking
+    // --------------------------------------------------------------------------------------------------------------
+    // Sites before GetUnmodifiedSize() have not been written, shifted or resized away since the last ClearModified(), so
+    // data derived from them (such as a label index) is still current.  Writing through operator[] counts as a
+    // modification, even if only used to read.
+    inline int GetUnmodifiedSize() const { return m_unmodified; }
+    inline void ClearModified() const { m_unmodified = m_active_size; }
+    
 
     // Subclassable Methods
     // --------------------------------------------------------------------------------------------------------------
@@ -118,12 +149,26 @@ namespace Avida {
     static int FindHammingDistance(const Sequence& seq1, const Sequence& seq2, int offset = 0);
     static int FindBestOffset(const Sequence& seq1, const Sequence& seq2);
     static int FindSlidingDistance(const Sequence& seq1, const Sequence& seq2);
-    static int FindEditDistance(const Sequence& seq1, const Sequence& seq2);
+    // With a non-negative threshold, any distance above it is reported as threshold + 1, allowing an early exit
+    static int FindEditDistance(const Sequence& seq1, const Sequence& seq2, int threshold = -1);
     
     
   protected:
     virtual void adjustCapacity(int new_size);
     virtual void prepareInsert(int pos, int num_sites);
+    
+    // Hash maintenance, each called before the corresponding change is made to m_seq
+    inline void hashSite(int idx, const cInstruction& old_inst, const cInstruction& new_inst)
+    {
+      if (m_hash_valid && old_inst != new_inst)
+        m_hash += (unsigned long long)(new_inst.GetOp() - old_inst.GetOp()) * hashPower(idx);
+    }
+    void hashInsert(int pos, const cInstruction& inst);
+    void hashRemove(int pos);
+    unsigned long long hashRange(int begin, int end) const;
+    static unsigned long long hashPower(int exp);
+    
+    inline void siteModified(int idx) { if (idx < m_unmodified) m_unmodified = idx; }
   };
 
 
@@ -27,7 +27,9 @@
 
 #include "apto/platform.h"
 #include "avida/core/Types.h"
+#include "avida/data/Recorder.h"
 #include "avida/data/Types.h"
+#include "avida/data/ValueTable.h"
 
 
 namespace Avida {
@@ -43,13 +45,40 @@ namespace Avida {
       Apto::Map<DataID, ProviderActivateFunctor> m_provider_map;
       mutable DataSetPtr m_available;
       
+      struct RecorderEntry
+      {
+        RecorderPtr recorder;
+        SampleSchedule schedule;
+        Update next_sample;             // -1 when only triggered samples remain
+        bool triggered;
+        bool uses_values;               // reads the value table directly rather than through NotifyData()
+        Apto::Array<int> providers;     // indices into m_active_providers of the providers of its requested values
+        
+        RecorderEntry() : next_sample(-1), triggered(false), uses_values(false) { ; }
+        
+        inline bool IsDue(Update update) const { return triggered || (next_sample >= 0 && next_sample <= update); }
+      };
+      
       Apto::Set<RecorderPtr> m_recorders;
+      Apto::Array<RecorderEntry> m_recorder_entries;
       
       Apto::Array<ProviderPtr> m_active_providers;
       Apto::Map<DataID, ProviderPtr> m_active_map;
+      Apto::Array<int> m_provider_due;
+      
+      // Merged schedule of all recorders; updates before m_next_sample are skipped unless a recorder was triggered
+      Update m_last_update;
+      Update m_next_sample;
+      bool m_triggered;
       
+      ValueTable m_values;
       mutable Apto::Map<DataID, PackagePtr> m_current_values;
       
+      
+      LIB_LOCAL void bindRecorder(RecorderEntry& entry);
+      LIB_LOCAL void rebuildActive();
+      LIB_LOCAL void updateNextSample();
+      
     public:
       LIB_EXPORT Manager(cWorld* world);
       LIB_EXPORT ~Manager();
@@ -61,6 +90,9 @@ namespace Avida {
       LIB_EXPORT bool AttachRecorder(RecorderPtr recorder);
       LIB_EXPORT bool DetachRecorder(RecorderPtr recorder);
       
+      // Notifies a recorder at the next UpdateState(), regardless of its schedule
+      LIB_EXPORT bool TriggerRecorder(RecorderPtr recorder);
+      
       LIB_EXPORT bool Register(const DataID& data_id, ProviderActivateFunctor functor);
       
     public:
@@ -46,6 +46,12 @@ namespace Avida {
       
       LIB_EXPORT virtual PackagePtr GetProvidedValue(const DataID& data_id) const = 0;
       LIB_EXPORT virtual Apto::String DescribeProvidedValue(const DataID& data_id) const = 0;
+      
+      // Typed value support (optional).  A provider that binds data_id adds it to the table, keeps the slot, and writes
+      // the value into it on every UpdateProvidedValues() until UnbindProvidedValues().  Unbound values are retrieved
+      // through GetProvidedValue().
+      LIB_EXPORT virtual bool BindProvidedValue(const DataID& data_id, ValueTable& table) { return false; }
+      LIB_EXPORT virtual void UnbindProvidedValues() { ; }
     };
     
   };
@@ -33,6 +33,39 @@
 namespace Avida {
   namespace Data {
     
+    // Data::SampleSchedule - Updates on which a recorder is notified of new data
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    // A recorder is notified every interval updates from start through stop (-1 for no end).  With an interval of 0,
+    // it is only notified on updates for which it has been triggered through Manager::TriggerRecorder().
+    
+    class SampleSchedule
+    {
+    private:
+      Update m_interval;
+      Update m_start;
+      Update m_stop;
+      
+    public:
+      LIB_EXPORT SampleSchedule(Update interval = 1, Update start = 0, Update stop = -1)
+        : m_interval(interval), m_start(start), m_stop(stop) { ; }
+      
+      LIB_EXPORT inline Update GetInterval() const { return m_interval; }
+      LIB_EXPORT inline Update GetStart() const { return m_start; }
+      LIB_EXPORT inline Update GetStop() const { return m_stop; }
+      
+      // Returns the first scheduled update at or after the given update, or -1 if there is none
+      LIB_EXPORT inline Update NextSample(Update update) const
+      {
+        if (m_interval <= 0) return -1;
+        if (update < m_start) update = m_start;
+        const Update offset = (update - m_start) % m_interval;
+        if (offset) update += m_interval - offset;
+        return (m_stop >= 0 && update > m_stop) ? -1 : update;
+      }
+    };
+    
+    
     // Data::Recorder - Protocol defining interface for data recorders that can attach to the data manager
     // --------------------------------------------------------------------------------------------------------------
     
@@ -44,6 +77,16 @@ namespace Avida {
       LIB_EXPORT virtual ConstDataSetPtr GetRequested() = 0;
       
       LIB_EXPORT virtual void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data) = 0; 
+      
+      // Typed value support (optional).  Once all requested values are active the manager offers the value table; a
+      // recorder that finds a slot for each of them returns true, and is then sent NotifyValues() instead of
+      // NotifyData().  Slots remain valid until the next call to BindValues().
+      LIB_EXPORT virtual bool BindValues(const ValueTable& table) { return false; }
+      LIB_EXPORT virtual void NotifyValues(Update current_update, const ValueTable& table) { ; }
+      
+      // Updates on which the recorder wants data; requested values are only updated on updates that some attached
+      // recorder has scheduled.  Read once, when the recorder is attached.
+      LIB_EXPORT virtual SampleSchedule GetSchedule() { return SampleSchedule(); }
     };
     
   };
@@ -41,14 +41,19 @@ namespace Avida {
     private:
       DataID m_data_id;
       ConstDataSetPtr m_requested;
+      ValueSlot m_slot;
+      SampleSchedule m_schedule;
       Apto::Array<T, Apto::Smart> m_data;
       
     public:
-      LIB_EXPORT TimeSeriesRecorder(const DataID& data_id);
+      LIB_EXPORT TimeSeriesRecorder(const DataID& data_id, const SampleSchedule& schedule = SampleSchedule());
       
       // Data::Recorder Interface
-      LIB_EXPORT inline ConstDataSetPtr GetRequested() const { return m_requested; }
+      LIB_EXPORT inline ConstDataSetPtr GetRequested() { return m_requested; }
       LIB_EXPORT void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data);
+      LIB_EXPORT bool BindValues(const ValueTable& table);
+      LIB_EXPORT void NotifyValues(Update current_update, const ValueTable& table);
+      LIB_EXPORT inline SampleSchedule GetSchedule() { return m_schedule; }
       
       // Value Access
       LIB_EXPORT inline int GetNumPoints() const { return m_data.GetSize(); }
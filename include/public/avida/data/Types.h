@@ -39,6 +39,7 @@ namespace Avida {
     class Package;
     class Provider;    
     class Recorder;
+    class ValueTable;
 
     
     // Type Declarations
@@ -59,6 +60,9 @@ namespace Avida {
     
     typedef Apto::Functor<PackagePtr, Apto::TL::Create<const DataID&> > DataRetrievalFunctor;
     
+    enum ValueType { VALUE_BOOL, VALUE_INT, VALUE_DOUBLE, VALUE_STRING };
+    typedef int ValueSlot; // Index of a value in a ValueTable, resolved when a recorder is attached
+    
   };
 };
 
@@ -0,0 +1,166 @@
+/*
+ *  data/ValueTable.h
+ *  avida-core
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Authors: David M. Bryson <david@programerror.com>
+ *
+ */
+
+#ifndef AvidaDataValueTable_h
+#define AvidaDataValueTable_h
+
+#include "apto/core/Array.h"
+#include "apto/core/Map.h"
+#include "apto/core/String.h"
+#include "apto/core/StringUtils.h"
+#include "apto/platform.h"
+#include "avida/data/Types.h"
+
+#include <cassert>
+
+
+namespace Avida {
+  namespace Data {
+
+    // Data::ValueTable - Current values of the active data, stored in typed columns and addressed by slot
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    // Slots are assigned when values become active, so providers write and recorders read each update without any
+    // lookups or allocation.  Reads of a slot as another type convert the same way Data::Wrap does.
+
+    class ValueTable
+    {
+    private:
+      struct SlotInfo
+      {
+        ValueType type;
+        int index;
+
+        SlotInfo() : type(VALUE_INT), index(0) { ; }
+        SlotInfo(ValueType in_type, int in_index) : type(in_type), index(in_index) { ; }
+      };
+
+      Apto::Map<DataID, ValueSlot> m_slot_map;
+      Apto::Array<SlotInfo> m_slots;
+
+      Apto::Array<int> m_int_values;   // int and bool values
+      Apto::Array<double> m_double_values;
+      Apto::Array<Apto::String> m_string_values;
+
+
+      ValueTable(const ValueTable&); // @not_implemented
+      ValueTable& operator=(const ValueTable&); // @not_implemented
+
+    public:
+      LIB_EXPORT ValueTable() { ; }
+
+      // Returns the slot of data_id, adding it as a value of the given type if it is not yet present
+      LIB_EXPORT ValueSlot AddValue(const DataID& data_id, ValueType type);
+
+      // Returns the slot of data_id, or -1 if it has not been added
+      LIB_EXPORT ValueSlot FindValue(const DataID& data_id) const;
+
+      LIB_EXPORT void Clear();
+
+      LIB_EXPORT inline int GetSize() const { return m_slots.GetSize(); }
+      LIB_EXPORT inline ValueType GetType(ValueSlot slot) const { return m_slots[slot].type; }
+
+
+      // Value Storage (by providers, in the slot's own type)
+      LIB_EXPORT inline void SetBool(ValueSlot slot, bool value);
+      LIB_EXPORT inline void SetInt(ValueSlot slot, int value);
+      LIB_EXPORT inline void SetDouble(ValueSlot slot, double value);
+      LIB_EXPORT inline void SetString(ValueSlot slot, const Apto::String& value);
+
+      // Value Access (by recorders)
+      LIB_EXPORT inline bool BoolValue(ValueSlot slot) const;
+      LIB_EXPORT inline int IntValue(ValueSlot slot) const;
+      LIB_EXPORT inline double DoubleValue(ValueSlot slot) const;
+      LIB_EXPORT Apto::String StringValue(ValueSlot slot) const;
+
+      // Copies the current value into a new package, for recorders that retain values in their original type
+      LIB_EXPORT PackagePtr PackageValue(ValueSlot slot) const;
+    };
+
+
+    inline void ValueTable::SetBool(ValueSlot slot, bool value)
+    {
+      assert(m_slots[slot].type == VALUE_BOOL);
+      m_int_values[m_slots[slot].index] = value;
+    }
+
+    inline void ValueTable::SetInt(ValueSlot slot, int value)
+    {
+      assert(m_slots[slot].type == VALUE_INT);
+      m_int_values[m_slots[slot].index] = value;
+    }
+
+    inline void ValueTable::SetDouble(ValueSlot slot, double value)
+    {
+      assert(m_slots[slot].type == VALUE_DOUBLE);
+      m_double_values[m_slots[slot].index] = value;
+    }
+
+    inline void ValueTable::SetString(ValueSlot slot, const Apto::String& value)
+    {
+      assert(m_slots[slot].type == VALUE_STRING);
+      m_string_values[m_slots[slot].index] = value;
+    }
+
+
+    inline bool ValueTable::BoolValue(ValueSlot slot) const
+    {
+      const SlotInfo& info = m_slots[slot];
+      switch (info.type) {
+        case VALUE_BOOL:
+        case VALUE_INT:     return m_int_values[info.index];
+        case VALUE_DOUBLE:  return m_double_values[info.index];
+        case VALUE_STRING:  return Apto::StrAs(m_string_values[info.index]);
+      }
+      return false;
+    }
+
+    inline int ValueTable::IntValue(ValueSlot slot) const
+    {
+      const SlotInfo& info = m_slots[slot];
+      switch (info.type) {
+        case VALUE_BOOL:
+        case VALUE_INT:     return m_int_values[info.index];
+        case VALUE_DOUBLE:  return (int)m_double_values[info.index];
+        case VALUE_STRING:  return Apto::StrAs(m_string_values[info.index]);
+      }
+      return 0;
+    }
+
+    inline double ValueTable::DoubleValue(ValueSlot slot) const
+    {
+      const SlotInfo& info = m_slots[slot];
+      switch (info.type) {
+        case VALUE_BOOL:
+        case VALUE_INT:     return m_int_values[info.index];
+        case VALUE_DOUBLE:  return m_double_values[info.index];
+        case VALUE_STRING:  return Apto::StrAs(m_string_values[info.index]);
+      }
+      return 0.0;
+    }
+
+  };
+};
+
+#endif
@@ -3268,7 +3268,7 @@ public:
 		for(int i=0; i<deme.GetSize(); ++i) {
 			cOrganism* org = deme.GetOrganism(i);
 			if(org != 0) {
-				tArray<int> reactions = org->GetPhenotype().GetCurReactionCount();
+				const tArraySlice<int>& reactions = org->GetPhenotype().GetCurReactionCount();
 				assert(reactions.GetSize() > 1);
 				
 				if (reactions[0]) performed_t1++;
@@ -3324,7 +3324,7 @@ public:
 			if(org != 0) {
 				bool performed_rx=false;
 				//				tArray<int> reactions = org->GetPhenotype().GetLastReactionCount();
-				tArray<int> reactions = org->GetPhenotype().GetCurReactionCount();
+				const tArraySlice<int>& reactions = org->GetPhenotype().GetCurReactionCount();
 				for(int j=0; j<reactions.GetSize(); ++j) {
 					if(reactions[j] > 0) {
 						uniq_reactions.insert(j);
@@ -3402,7 +3402,7 @@ public:
 			cOrganism* org = deme.GetOrganism(i);
       string p = desired_phenotypes[i];
 			if(org != 0) {
-        tArray<int> reactions = org->GetPhenotype().GetCurReactionCount();
+        const tArraySlice<int>& reactions = org->GetPhenotype().GetCurReactionCount();
 				for(int j=0; j<reactions.GetSize(); ++j) {
           char curp= p[j];
           int des =  atoi(&curp);
@@ -4086,8 +4086,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4163,8 +4163,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4225,8 +4225,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4301,8 +4301,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4360,8 +4360,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cCellConnections& cellA_list = cellA.ConnectionList();
+    cCellConnections& cellB_list = cellB.ConnectionList();
     cellA_list.PushRear(&cellB);
     cellB_list.PushRear(&cellA);
   }
@@ -4400,8 +4400,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cCellConnections& cellA_list = cellA.ConnectionList();
+    cCellConnections& cellB_list = cellB.ConnectionList();
     cellA_list.Remove(&cellB);
     cellB_list.Remove(&cellA);
   }
@@ -1365,7 +1365,7 @@ public:
     }
     
     ofstream& fp = m_world->GetDataFileManager().GetOFStream(filename);
-    if (!fp.is_open())
+    if (!fp.good())
       m_world->GetDriver().RaiseFatalException(1, "PrintCCladeCount: Unable to open output file.");
     if (first_time)
     {
@@ -1839,7 +1839,7 @@ public:
     
     //Create and print the histograms; this calls a static method in another action
     ofstream& fp = m_world->GetDataFileManager().GetOFStream(m_filename);
-    if (!fp.is_open())
+    if (!fp.good())
       m_world->GetDriver().RaiseFatalException(1, "PrintCCladeFitnessHistogram: Unable to open output file.");
     map< int, tArray<cOrganism*> >::iterator oit = org_map.begin();
     map< int, tArray<cBioGroup*> >::iterator git = gen_map.begin();
@@ -1960,7 +1960,7 @@ public:
     
     //Create and print the histograms; this calls a static method in another action
     ofstream& fp = m_world->GetDataFileManager().GetOFStream(m_filename);
-    if (!fp.is_open())
+    if (!fp.good())
       m_world->GetDriver().RaiseFatalException(1, "PrintCCladeRelativeFitnessHistogram: Unable to open output file.");
     map< int, tArray<cOrganism*> >::iterator oit = org_map.begin();
     map< int, tArray<cBioGroup*> >::iterator git = gen_map.begin();
@@ -2158,7 +2158,7 @@ private:
       << pp->GetFitness() << " "
       << pp->GetMerit() << " "
       << pp->GetGestationTime() << " ";
-      tArray<int> tasks = pp->GetLastTaskCount();
+      const tArraySlice<int>& tasks = pp->GetLastTaskCount();
       for (int t = 0; t < tasks.GetSize(); t++)
         fot << tasks[t] << " ";
       tArray<int> env_inputs = pp->GetEnvInputs();
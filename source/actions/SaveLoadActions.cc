@@ -26,6 +26,7 @@
 #include "cArgContainer.h"
 #include "cArgSchema.h"
 #include "cClassificationManager.h"
+#include "cDataFileManager.h"
 #include "cPopulation.h"
 #include "cStats.h"
 #include "cStringUtil.h"
@@ -127,6 +128,9 @@ public:
     int update = m_world->GetStats().GetUpdate();
     cString filename = cStringUtil::Stringf("%s-%d.spop", (const char*)m_filename, update);
     m_world->GetPopulation().SavePopulation(filename, m_save_historic, m_save_group_info, m_save_avatars, m_save_rebirth);
+    
+    // Bring the data files up to date with the checkpoint
+    m_world->GetDataFileManager().FlushAll();
   }
 };
 
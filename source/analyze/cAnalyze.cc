@@ -49,6 +49,7 @@
 #include "cInstSet.h"
 #include "cLandscape.h"
 #include "cModularityAnalysis.h"
+#include "cPairwiseDistances.h"
 #include "cPhenotype.h"
 #include "cPhenPlastGenotype.h"
 #include "cPlasticPhenotype.h"
@@ -3074,7 +3075,8 @@ void cAnalyze::PhyloCommunityComplexity(cString cur_string)
 }
 
 
-// Calculate Edit Distance stats for all pairs of organisms across the population.
+// Calculate Edit Distance stats for all pairs of organisms across the population.  In matrix mode the full genotype
+// distance matrix is written in binary instead, and in knn mode the k nearest neighbors of each genotype.
 void cAnalyze::CommandPrintDistances(cString cur_string)
 {
   cout << "Calculating Edit Distance between all pairs of genotypes." << endl;
@@ -3088,8 +3090,38 @@ void cAnalyze::CommandPrintDistances(cString cur_string)
     filename = "edit_distance.dat";
   }
   
+  cString mode = cur_string.PopWord();
+  if (mode.IsEmpty()) mode = "summary";
+  if (mode != "summary" && mode != "matrix" && mode != "knn") {
+    cerr << "Error: Unknown PRINT_DISTANCES mode '" << mode << "'" << endl;
+    return;
+  }
+  
+  cPairwiseDistances distances(m_jobqueue, batch[cur_batch].List());
+  
+  if (mode == "matrix") {
+    distances.WriteMatrix(m_world->GetDataFileOFStream(filename), dist_threshold);
+    m_world->GetDataFileManager().Remove(filename);
+    return;
+  }
+  
   ofstream & fout = m_world->GetDataFileOFStream(filename);
   
+  if (mode == "knn") {
+    int k = cur_string.PopWord().AsInt();
+    if (k < 1) k = 10;
+    
+    fout << "# Nearest genotypes by edit distance (k = " << k << ")" << endl;
+    fout << "# 1: Genotype ID" << endl;
+    fout << "# 2: Neighbor genotype ID" << endl;
+    fout << "# 3: Edit distance" << endl;
+    if (dist_threshold > 0) fout << "# Neighbors at or above distance " << dist_threshold << " are omitted" << endl;
+    fout << endl;
+    
+    distances.WriteNearest(fout, k, dist_threshold);
+    return;
+  }
+  
   fout << "# All pairs edit distance" << endl;
   fout << "# 1: Num organism pairs" << endl;
 	fout << "# 2: Mean distance computed using (n*(n-1)/2) as all pairs." << endl;
@@ -3099,49 +3131,16 @@ void cAnalyze::CommandPrintDistances(cString cur_string)
   fout << endl;
   
   // Loop through all pairs of organisms.
-  int dist_total = 0;
-  int dist_max = 0;
-  int pair_count = 0;
-  int threshold_pair_count = 0;
-	double count = 0;
-	
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  tListIterator<cAnalyzeGenotype> batch_it1(batch[cur_batch].List());
-
-  int watermark = 0;
-  
-  while ((genotype1 = batch_it1.Next()) != NULL) {
-		count ++;
-    const int gen1_count = genotype1->GetNumCPUs();
-
-    // Pair this genotype with itself for a distance of 0.
-    pair_count += gen1_count * (gen1_count - 1) / 2;
-
-    // Loop through the other genotypes this one can be paired with.
-    tListIterator<cAnalyzeGenotype> batch_it2(batch_it1);
-    while ((genotype2 = batch_it2.Next()) != NULL) {
-      const int gen2_count = genotype2->GetNumCPUs();
-      const int cur_pairs = gen1_count * gen2_count;
-      const int cur_dist = Sequence::FindEditDistance(genotype1->GetGenome().GetSequence(), genotype2->GetGenome().GetSequence());
-      dist_total += cur_pairs * cur_dist;
-      if (cur_dist > dist_max) dist_max = cur_dist;
-      pair_count += cur_pairs;
-      if (cur_dist >= dist_threshold) threshold_pair_count += cur_pairs;
-
-      if (pair_count > watermark) {
-	cout << watermark << endl;
-	watermark += 100000;
-      }
-    }
-  }
+  cPairwiseDistances::sSummary summary;
+  distances.CalcSummary(dist_threshold, summary);
   
+	double count = distances.GetSize();
 	count = (count * (count-1) ) /2;
-  fout << pair_count << " "
-	     << ((double) dist_total) / count << " " 
-       << ((double) dist_total) / (double) pair_count << " "
-       << dist_max << " "
-       << ((double) threshold_pair_count) / (double) pair_count << " "
+  fout << summary.pair_count << " "
+	     << ((double) summary.dist_total) / count << " " 
+       << ((double) summary.dist_total) / (double) summary.pair_count << " "
+       << summary.dist_max << " "
+       << ((double) summary.threshold_pairs) / (double) summary.pair_count << " "
        << endl;
 
   return;
@@ -5697,32 +5696,12 @@ void cAnalyze::CommandHamming(cString cur_string)
     cout.flush();
   }
   
-  // Setup some variables;
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  int total_dist = 0;
-  int total_count = 0;
-  
-  tListIterator<cAnalyzeGenotype> list1_it(batch[batch1].List());
-  tListIterator<cAnalyzeGenotype> list2_it(batch[batch2].List());
-  
-  while ((genotype1 = list1_it.Next()) != NULL) {
-    list2_it.Reset();
-    while ((genotype2 = list2_it.Next()) != NULL) {
-      // Determine the counts...
-      const int count1 = genotype1->GetNumCPUs();
-      const int count2 = genotype2->GetNumCPUs();
-      const int num_pairs = (genotype1 == genotype2) ?
-        ((count1 - 1) * (count2 - 1)) : (count1 * count2);
-      if (num_pairs == 0) continue;
-      
-      // And do the tests...
-      const int dist = Sequence::FindHammingDistance(genotype1->GetGenome().GetSequence(), genotype2->GetGenome().GetSequence());
-      total_dist += dist * num_pairs;
-      total_count += num_pairs;
-    }
-  }
-  
+  // Compare every genotype of batch1 against every genotype of batch2 on the analyze job queue
+  cPairwiseDistances set1(m_jobqueue, batch[batch1].List(), cPairwiseDistances::HAMMING_DISTANCE);
+  cPairwiseDistances set2(m_jobqueue, batch[batch2].List(), cPairwiseDistances::HAMMING_DISTANCE);
+  long total_dist = 0;
+  long total_count = 0;
+  set1.CalcCrossTotals(set2, total_dist, total_count);
   
   // Calculate the final answer
   double ave_dist = (double) total_dist / (double) total_count;
@@ -5762,33 +5741,12 @@ void cAnalyze::CommandLevenstein(cString cur_string)
     cout.flush();
   }
   
-  // Setup some variables;
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  int total_dist = 0;
-  int total_count = 0;
-  
-  tListIterator<cAnalyzeGenotype> list1_it(batch[batch1].List());
-  tListIterator<cAnalyzeGenotype> list2_it(batch[batch2].List());
-  
-  // Loop through all of the genotypes in each batch...
-  while ((genotype1 = list1_it.Next()) != NULL) {
-    list2_it.Reset();
-    while ((genotype2 = list2_it.Next()) != NULL) {
-      // Determine the counts...
-      const int count1 = genotype1->GetNumCPUs();
-      const int count2 = genotype2->GetNumCPUs();
-      const int num_pairs = (genotype1 == genotype2) ?
-        ((count1 - 1) * (count2 - 1)) : (count1 * count2);
-      if (num_pairs == 0) continue;
-      
-      // And do the tests...
-      const int dist = Sequence::FindEditDistance(genotype1->GetGenome().GetSequence(),
-                                                     genotype2->GetGenome().GetSequence());
-      total_dist += dist * num_pairs;
-      total_count += num_pairs;
-    }
-  }
+  // Compare every genotype of batch1 against every genotype of batch2 on the analyze job queue
+  cPairwiseDistances set1(m_jobqueue, batch[batch1].List(), cPairwiseDistances::EDIT_DISTANCE);
+  cPairwiseDistances set2(m_jobqueue, batch[batch2].List(), cPairwiseDistances::EDIT_DISTANCE);
+  long total_dist = 0;
+  long total_count = 0;
+  set1.CalcCrossTotals(set2, total_dist, total_count);
   
   // Calculate the final answer
   double ave_dist = (double) total_dist / (double) total_count;
@@ -8546,19 +8504,7 @@ void cAnalyze::BatchRecalculate(cString cur_string)
     m_world->GetDriver().NotifyWarning(msg);
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info);
-    }
-    last_genotype = genotype;
-  }
+  RecalculateBatch(test_info);
     
   return;
 }
@@ -8633,21 +8579,67 @@ void cAnalyze::BatchRecalculateWithArgs(cString cur_string)
     m_world->GetDriver().NotifyWarning(msg);
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype, num_trials);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info, NULL, num_trials);
+  RecalculateBatch(test_info, num_trials);
+  
+  return;
+}
+
+
+// Test CPU work for a contiguous range of the current batch, run on the analyze job queue
+class cRecalculateJob
+{
+private:
+  cWorld* m_world;
+  cCPUTestInfo m_test_info;
+  int m_num_trials;
+  tArray<cAnalyzeGenotype*> m_genotypes;
+  
+public:
+  cRecalculateJob(cWorld* world, const cCPUTestInfo& test_info, int num_trials, int num_genotypes)
+    : m_world(world), m_test_info(test_info), m_num_trials(num_trials), m_genotypes(num_genotypes) { ; }
+  
+  void SetGenotype(int idx, cAnalyzeGenotype* genotype) { m_genotypes[idx] = genotype; }
+  
+  void Recalculate(cAvidaContext& ctx)
+  {
+    // One test CPU serves every genotype in this job
+    cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    for (int i = 0; i < m_genotypes.GetSize(); i++) {
+      m_genotypes[i]->Recalculate(ctx, &m_test_info, NULL, m_num_trials, test_cpu);
     }
-    last_genotype = genotype;
+    delete test_cpu;
   }
+};
+
+
+void cAnalyze::RecalculateBatch(const cCPUTestInfo& test_info, int num_trials)
+{
+  tArray<cAnalyzeGenotype*> genotypes(batch[cur_batch].List().GetSize());
+  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+  for (int i = 0; i < genotypes.GetSize(); i++) genotypes[i] = batch_it.Next();
+  
+  // Split the batch into contiguous ranges, at most one per pooled RNG, so that no two jobs of a batch share a
+  // random number generator and results do not depend on the number of worker threads
+  const int num_jobs = (genotypes.GetSize() < MT_RANDOM_POOL_SIZE) ? genotypes.GetSize() : MT_RANDOM_POOL_SIZE;
+  tArray<cRecalculateJob*> jobs(num_jobs);
+  tAnalyzeJobBatch<cRecalculateJob> jobbatch(m_jobqueue);
+  int start = 0;
+  for (int j = 0; j < num_jobs; j++) {
+    const int end = (genotypes.GetSize() * (j + 1)) / num_jobs;
+    jobs[j] = new cRecalculateJob(m_world, test_info, num_trials, end - start);
+    for (int i = start; i < end; i++) jobs[j]->SetGenotype(i - start, genotypes[i]);
+    jobbatch.AddJob(jobs[j], &cRecalculateJob::Recalculate);
+    start = end;
+  }
+  jobbatch.RunBatch();
+  for (int j = 0; j < num_jobs; j++) delete jobs[j];
   
-  return;
+  // Parent stats rely on the parent's recalculated values and accumulate ancestor distance along the lineage, so
+  // they are applied in batch order once all genotypes have been tested.  If the previous genotype was the parent
+  // of this one, it supplies the distance to parent, etc.
+  for (int i = 1; i < genotypes.GetSize(); i++) {
+    if (genotypes[i]->GetParentID() == genotypes[i - 1]->GetID()) genotypes[i]->CalcParentStats(genotypes[i - 1]);
+  }
 }
 
 
@@ -302,6 +302,7 @@ private:
   void BatchDuplicate(cString cur_string);
   void BatchRecalculate(cString cur_string);
   void BatchRecalculateWithArgs(cString cur_string);
+  void RecalculateBatch(const cCPUTestInfo& test_info, int num_trials = 1);
   void BatchRename(cString cur_string);
   void CloseFile(cString cur_string);
   void PrintStatus(cString cur_string);
@@ -549,7 +549,8 @@ void cAnalyzeGenotype::CalcLandscape(cAvidaContext& ctx)
 }
 
 
-void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info, cAnalyzeGenotype* parent_genotype, int num_trials)
+void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info, cAnalyzeGenotype* parent_genotype, int num_trials,
+                                   cTestCPU* test_cpu)
 {  
   // Allocate our own test info if it wasn't provided
   tAutoRelease<cCPUTestInfo> local_test_info;
@@ -560,7 +561,7 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   }
   
   // Handling recalculation here
-  cPhenPlastGenotype recalc_data(m_genome, num_trials, *test_info, m_world, ctx);
+  cPhenPlastGenotype recalc_data(m_genome, num_trials, *test_info, m_world, ctx, test_cpu);
   
   // The most likely phenotype will be assigned to the phenotype stats
   const cPlasticPhenotype* likely_phenotype = recalc_data.GetMostLikelyPhenotype();
@@ -578,12 +579,12 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   errors                = likely_phenotype->GetLastNumErrors();
   div_type              = likely_phenotype->GetDivType();
   mate_id               = likely_phenotype->MateSelectID();
-  task_counts           = likely_phenotype->GetLastTaskCount();
-  task_qualities        = likely_phenotype->GetLastTaskQuality();
-  internal_task_counts  = likely_phenotype->GetLastInternalTaskCount();
-  internal_task_qualities = likely_phenotype->GetLastInternalTaskQuality();
-  rbins_total           = likely_phenotype->GetLastRBinsTotal();
-  rbins_avail           = likely_phenotype->GetLastRBinsAvail();
+  task_counts           = likely_phenotype->GetLastTaskCount().AsArray();
+  task_qualities        = likely_phenotype->GetLastTaskQuality().AsArray();
+  internal_task_counts  = likely_phenotype->GetLastInternalTaskCount().AsArray();
+  internal_task_qualities = likely_phenotype->GetLastInternalTaskQuality().AsArray();
+  rbins_total           = likely_phenotype->GetLastRBinsTotal().AsArray();
+  rbins_avail           = likely_phenotype->GetLastRBinsAvail().AsArray();
   collect_spec_counts   = likely_phenotype->GetLastCollectSpecCounts();
   m_mating_type 		= likely_phenotype->GetMatingType(); //@CHC
   m_mate_preference     = likely_phenotype->GetMatePreference(); //@CHC
@@ -592,14 +593,7 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
 
   
   // Setup a new parent stats if we have a parent to work with.
-  if (parent_genotype != NULL) {
-    fitness_ratio = GetFitness() / parent_genotype->GetFitness();
-    efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
-    comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
-    parent_dist = cStringUtil::EditDistance(m_genome.GetSequence().AsString(), parent_genotype->GetGenome().GetSequence().AsString(), parent_muts);
-    
-    ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
-  }
+  if (parent_genotype != NULL) CalcParentStats(parent_genotype);
   
   // Summarize plasticity information if multiple recalculations performed
   if (num_trials > 1){
@@ -610,6 +604,19 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
 }
 
 
+// Parent stats depend on the parent's recalculated values, so batch recalculations that test genotypes
+// concurrently apply them afterward, in lineage order.
+void cAnalyzeGenotype::CalcParentStats(cAnalyzeGenotype* parent_genotype)
+{
+  fitness_ratio = GetFitness() / parent_genotype->GetFitness();
+  efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
+  comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
+  parent_dist = cStringUtil::EditDistance(m_genome.GetSequence().AsString(), parent_genotype->GetGenome().GetSequence().AsString(), parent_muts);
+  
+  ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
+}
+
+
 void cAnalyzeGenotype::PrintTasks(ofstream& fp, int min_task, int max_task)
 {
   if (max_task == -1) max_task = task_counts.GetSize();
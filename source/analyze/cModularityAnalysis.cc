@@ -65,7 +65,7 @@ void cModularityAnalysis::CalcFunctionalModularity(cAvidaContext& ctx)
     
   // Check if the organism does any tasks
   bool does_tasks = false;
-  const tArray<int> base_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+  const tArraySlice<int>& base_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
   const int num_tasks = base_tasks.GetSize();
   for (int i = 0; i < num_tasks; i++) {
     if (base_tasks[i] > 0) {
@@ -102,7 +102,7 @@ void cModularityAnalysis::CalcFunctionalModularity(cAvidaContext& ctx)
       testcpu->TestGenome(ctx, test_info, mod_genome);
       
       if (test_info.GetColonyFitness() > 0.0) {
-        const tArray<int>& test_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+        const tArraySlice<int>& test_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
         
         for (int cur_task = 0; cur_task < num_tasks; cur_task++) {
           // This is done so that under 'binary' option it marks
@@ -165,7 +165,7 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
   m_base_fitness = test_info.GetColonyFitness();
   m_base_merit = phenotype.GetMerit().GetDouble();
   m_base_gestation = phenotype.GetGestationTime();
-  m_base_tasks = phenotype.GetLastTaskCount();
+  m_base_tasks = phenotype.GetLastTaskCount().AsArray();
   
   m_neut_min = m_base_fitness * nHardware::FITNESS_NEUTRAL_MIN;
   m_neut_max = m_base_fitness * nHardware::FITNESS_NEUTRAL_MAX;
@@ -301,7 +301,7 @@ double cMutationalNeighborhood::ProcessOneStepGenome(cAvidaContext& ctx, cTestCP
   if (test_fitness >= m_neut_min) odata.site_count[cur_site]++;
   
   if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const tArray<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
+    const tArraySlice<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
     bool knockout = false;
     bool anytask = false;
     for (int i = 0; i < m_base_tasks.GetSize(); i++) {
@@ -498,7 +498,7 @@ double cMutationalNeighborhood::ProcessTwoStepGenome(cAvidaContext& ctx, cTestCP
   if (test_fitness >= m_neut_min) tdata.site_count[cur.site]++;
   
   if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const tArray<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
+    const tArraySlice<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
     bool knockout = false;
     bool anytask = false;
     for (int i = 0; i < m_base_tasks.GetSize(); i++) {
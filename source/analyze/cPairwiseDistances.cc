@@ -0,0 +1,349 @@
+/*
+ *  cPairwiseDistances.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cPairwiseDistances.h"
+
+#include "avida/core/Sequence.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cAnalyzeJobQueue.h"
+#include "tAnalyzeJobBatch.h"
+
+using namespace std;
+
+
+// Genotypes per side of a square tile of the pair matrix
+static const int TILE_SIZE = 64;
+
+// Genotypes per job for row oriented passes (nearest neighbors, cross batch totals)
+static const int ROW_CHUNK = 16;
+
+// Largest distance representable in the binary matrix
+static const int MATRIX_MAX_DIST = 0xFFFF;
+
+
+// Distances for the pairs of one tile.  Summary statistics are accumulated when no matrix rows are supplied,
+// otherwise each distance is stored in its row of the current matrix band.
+class cPairwiseDistances::cTileJob
+{
+private:
+  const cPairwiseDistances& m_pairs;
+  int m_row_begin;
+  int m_row_end;
+  int m_col_begin;
+  int m_col_end;
+  int m_threshold;
+  unsigned short** m_rows;
+  sSummary m_summary;
+
+public:
+  cTileJob(const cPairwiseDistances& pairs, int row_begin, int col_begin, int threshold, unsigned short** rows = NULL)
+    : m_pairs(pairs), m_row_begin(row_begin), m_col_begin(col_begin), m_threshold(threshold), m_rows(rows)
+  {
+    m_row_end = (row_begin + TILE_SIZE < pairs.GetSize()) ? row_begin + TILE_SIZE : pairs.GetSize();
+    m_col_end = (col_begin + TILE_SIZE < pairs.GetSize()) ? col_begin + TILE_SIZE : pairs.GetSize();
+  }
+
+  const sSummary& GetSummary() const { return m_summary; }
+
+  void Run(cAvidaContext& ctx)
+  {
+    for (int i = m_row_begin; i < m_row_end; i++) {
+      // Tiles on the diagonal only cover the pairs above it
+      const int col_begin = (m_col_begin > i) ? m_col_begin : i + 1;
+
+      if (m_rows) {
+        unsigned short* row = m_rows[i - m_row_begin];
+        for (int j = col_begin; j < m_col_end; j++) row[j - i - 1] = m_pairs.distance(i, j, m_threshold - 1);
+        continue;
+      }
+
+      const long long count1 = m_pairs.m_genotypes[i]->GetNumCPUs();
+      for (int j = col_begin; j < m_col_end; j++) {
+        const long long cur_pairs = count1 * m_pairs.m_genotypes[j]->GetNumCPUs();
+        const int cur_dist = m_pairs.distance(i, j, -1);
+        m_summary.dist_total += cur_pairs * cur_dist;
+        if (cur_dist > m_summary.dist_max) m_summary.dist_max = cur_dist;
+        m_summary.pair_count += cur_pairs;
+        if (cur_dist >= m_threshold) m_summary.threshold_pairs += cur_pairs;
+      }
+    }
+  }
+};
+
+
+// The k nearest genotypes to each genotype in a contiguous range, kept sorted by distance and then by batch position
+class cPairwiseDistances::cNearestJob
+{
+private:
+  const cPairwiseDistances& m_pairs;
+  int m_begin;
+  int m_end;
+  int m_k;
+  int m_max_dist;
+  tArray<int> m_num_neighbors;
+  tArray<int> m_neighbor;
+  tArray<int> m_neighbor_dist;
+
+public:
+  cNearestJob(const cPairwiseDistances& pairs, int begin, int end, int k, int max_dist)
+    : m_pairs(pairs), m_begin(begin), m_end(end), m_k(k), m_max_dist(max_dist)
+    , m_num_neighbors(end - begin, 0), m_neighbor((end - begin) * k), m_neighbor_dist((end - begin) * k) { ; }
+
+  int GetNumNeighbors(int i) const { return m_num_neighbors[i - m_begin]; }
+  int GetNeighbor(int i, int n) const { return m_neighbor[(i - m_begin) * m_k + n]; }
+  int GetNeighborDist(int i, int n) const { return m_neighbor_dist[(i - m_begin) * m_k + n]; }
+
+  void Run(cAvidaContext& ctx)
+  {
+    for (int i = m_begin; i < m_end; i++) {
+      int* neighbor = &m_neighbor[(i - m_begin) * m_k];
+      int* neighbor_dist = &m_neighbor_dist[(i - m_begin) * m_k];
+      int num = 0;
+
+      for (int j = 0; j < m_pairs.GetSize(); j++) {
+        if (j == i) continue;
+
+        // Largest distance that can still enter the list; later genotypes lose ties, so a full list needs strictly less
+        // than its last entry
+        int bound = (m_max_dist > 0) ? m_max_dist - 1 : -1;
+        if (num == m_k) {
+          if (neighbor_dist[m_k - 1] == 0) break;
+          if (bound < 0 || neighbor_dist[m_k - 1] - 1 < bound) bound = neighbor_dist[m_k - 1] - 1;
+        }
+
+        const int dist = m_pairs.distance(i, j, bound);
+        if (bound >= 0 && dist > bound) continue;
+
+        int pos = (num < m_k) ? num++ : m_k - 1;
+        while (pos > 0 && neighbor_dist[pos - 1] > dist) {
+          neighbor[pos] = neighbor[pos - 1];
+          neighbor_dist[pos] = neighbor_dist[pos - 1];
+          pos--;
+        }
+        neighbor[pos] = j;
+        neighbor_dist[pos] = dist;
+      }
+
+      m_num_neighbors[i - m_begin] = num;
+    }
+  }
+};
+
+
+// Organism weighted distance totals between a contiguous range of one set and every genotype of another
+class cPairwiseDistances::cCrossJob
+{
+private:
+  const cPairwiseDistances& m_pairs;
+  const cPairwiseDistances& m_other;
+  int m_begin;
+  int m_end;
+  long m_total_dist;
+  long m_total_count;
+
+public:
+  cCrossJob(const cPairwiseDistances& pairs, const cPairwiseDistances& other, int begin, int end)
+    : m_pairs(pairs), m_other(other), m_begin(begin), m_end(end), m_total_dist(0), m_total_count(0) { ; }
+
+  long GetTotalDist() const { return m_total_dist; }
+  long GetTotalCount() const { return m_total_count; }
+
+  void Run(cAvidaContext& ctx)
+  {
+    for (int i = m_begin; i < m_end; i++) {
+      cAnalyzeGenotype* genotype1 = m_pairs.m_genotypes[i];
+      const long count1 = genotype1->GetNumCPUs();
+      for (int j = 0; j < m_other.GetSize(); j++) {
+        cAnalyzeGenotype* genotype2 = m_other.m_genotypes[j];
+        const long count2 = genotype2->GetNumCPUs();
+        const long num_pairs = (genotype1 == genotype2) ? ((count1 - 1) * (count2 - 1)) : (count1 * count2);
+        if (num_pairs == 0) continue;
+
+        m_total_dist += m_pairs.distance(*m_pairs.m_seqs[i], *m_other.m_seqs[j], -1) * num_pairs;
+        m_total_count += num_pairs;
+      }
+    }
+  }
+};
+
+
+static void writeUInt32(ostream& fp, unsigned int value)
+{
+  char bytes[4];
+  for (int b = 0; b < 4; b++) bytes[b] = (char)((value >> (8 * b)) & 0xFF);
+  fp.write(bytes, 4);
+}
+
+
+cPairwiseDistances::cPairwiseDistances(cAnalyzeJobQueue& jobqueue, tList<cAnalyzeGenotype>& genotypes, eMetric metric)
+  : m_jobqueue(jobqueue), m_metric(metric), m_genotypes(genotypes.GetSize()), m_seqs(genotypes.GetSize())
+{
+  tListIterator<cAnalyzeGenotype> batch_it(genotypes);
+  for (int i = 0; i < m_genotypes.GetSize(); i++) {
+    m_genotypes[i] = batch_it.Next();
+    m_seqs[i] = &m_genotypes[i]->GetGenome().GetSequence();
+  }
+}
+
+
+int cPairwiseDistances::distance(const Sequence& seq1, const Sequence& seq2, int threshold) const
+{
+  if (m_metric == EDIT_DISTANCE) return Sequence::FindEditDistance(seq1, seq2, threshold);
+
+  const int dist = Sequence::FindHammingDistance(seq1, seq2);
+  return (threshold >= 0 && dist > threshold) ? threshold + 1 : dist;
+}
+
+
+void cPairwiseDistances::CalcSummary(int threshold, sSummary& summary)
+{
+  const int n = GetSize();
+  const int num_tiles = (n + TILE_SIZE - 1) / TILE_SIZE;
+
+  tArray<cTileJob*> jobs(num_tiles * (num_tiles + 1) / 2);
+  tAnalyzeJobBatch<cTileJob> jobbatch(m_jobqueue);
+  int job_id = 0;
+  for (int row = 0; row < n; row += TILE_SIZE) {
+    for (int col = row; col < n; col += TILE_SIZE) {
+      jobs[job_id] = new cTileJob(*this, row, col, threshold);
+      jobbatch.AddJob(jobs[job_id], &cTileJob::Run);
+      job_id++;
+    }
+  }
+  jobbatch.RunBatch();
+
+  summary = sSummary();
+
+  // Pair each genotype with itself for a distance of 0
+  for (int i = 0; i < n; i++) {
+    const long long count = m_genotypes[i]->GetNumCPUs();
+    summary.pair_count += count * (count - 1) / 2;
+  }
+
+  for (int t = 0; t < jobs.GetSize(); t++) {
+    const sSummary& tile = jobs[t]->GetSummary();
+    summary.pair_count += tile.pair_count;
+    summary.dist_total += tile.dist_total;
+    if (tile.dist_max > summary.dist_max) summary.dist_max = tile.dist_max;
+    summary.threshold_pairs += tile.threshold_pairs;
+    delete jobs[t];
+  }
+}
+
+
+void cPairwiseDistances::WriteMatrix(ostream& fp, int cap)
+{
+  const int n = GetSize();
+  if (cap <= 0 || cap > MATRIX_MAX_DIST) cap = MATRIX_MAX_DIST;
+
+  // Header: magic, format version, genotype count, distance cap, then the genotype IDs in matrix order
+  fp.write("AVDM", 4);
+  writeUInt32(fp, 1);
+  writeUInt32(fp, n);
+  writeUInt32(fp, cap);
+  for (int i = 0; i < n; i++) writeUInt32(fp, m_genotypes[i]->GetID());
+
+  tArray<unsigned short> band;
+  tArray<unsigned short*> rows(TILE_SIZE);
+  tArray<char> bytes;
+  for (int row = 0; row < n; row += TILE_SIZE) {
+    const int row_end = (row + TILE_SIZE < n) ? row + TILE_SIZE : n;
+
+    // Rows of the band are laid out back to back, exactly as they appear in the file
+    int band_size = 0;
+    for (int i = row; i < row_end; i++) band_size += n - i - 1;
+    if (band_size == 0) break;
+    band.ResizeClear(band_size);
+    int offset = 0;
+    for (int i = row; i < row_end; i++) {
+      rows[i - row] = &band[0] + offset;
+      offset += n - i - 1;
+    }
+
+    const int num_tiles = (n - row + TILE_SIZE - 1) / TILE_SIZE;
+    tArray<cTileJob*> jobs(num_tiles);
+    tAnalyzeJobBatch<cTileJob> jobbatch(m_jobqueue);
+    for (int t = 0; t < num_tiles; t++) {
+      jobs[t] = new cTileJob(*this, row, row + t * TILE_SIZE, cap, &rows[0]);
+      jobbatch.AddJob(jobs[t], &cTileJob::Run);
+    }
+    jobbatch.RunBatch();
+    for (int t = 0; t < num_tiles; t++) delete jobs[t];
+
+    bytes.ResizeClear(band_size * 2);
+    for (int e = 0; e < band_size; e++) {
+      bytes[2 * e] = (char)(band[e] & 0xFF);
+      bytes[2 * e + 1] = (char)(band[e] >> 8);
+    }
+    fp.write(&bytes[0], bytes.GetSize());
+  }
+}
+
+
+void cPairwiseDistances::WriteNearest(ostream& fp, int k, int max_dist)
+{
+  const int n = GetSize();
+  if (k < 1) k = 1;
+
+  const int num_jobs = (n + ROW_CHUNK - 1) / ROW_CHUNK;
+  tArray<cNearestJob*> jobs(num_jobs);
+  tAnalyzeJobBatch<cNearestJob> jobbatch(m_jobqueue);
+  for (int j = 0; j < num_jobs; j++) {
+    const int begin = j * ROW_CHUNK;
+    jobs[j] = new cNearestJob(*this, begin, (begin + ROW_CHUNK < n) ? begin + ROW_CHUNK : n, k, max_dist);
+    jobbatch.AddJob(jobs[j], &cNearestJob::Run);
+  }
+  jobbatch.RunBatch();
+
+  for (int i = 0; i < n; i++) {
+    const cNearestJob& job = *jobs[i / ROW_CHUNK];
+    for (int nb = 0; nb < job.GetNumNeighbors(i); nb++) {
+      fp << m_genotypes[i]->GetID() << " " << m_genotypes[job.GetNeighbor(i, nb)]->GetID() << " "
+         << job.GetNeighborDist(i, nb) << endl;
+    }
+  }
+
+  for (int j = 0; j < num_jobs; j++) delete jobs[j];
+}
+
+
+void cPairwiseDistances::CalcCrossTotals(cPairwiseDistances& other_set, long& total_dist, long& total_count)
+{
+  const int n = GetSize();
+  const int num_jobs = (n + ROW_CHUNK - 1) / ROW_CHUNK;
+  tArray<cCrossJob*> jobs(num_jobs);
+  tAnalyzeJobBatch<cCrossJob> jobbatch(m_jobqueue);
+  for (int j = 0; j < num_jobs; j++) {
+    const int begin = j * ROW_CHUNK;
+    jobs[j] = new cCrossJob(*this, other_set, begin, (begin + ROW_CHUNK < n) ? begin + ROW_CHUNK : n);
+    jobbatch.AddJob(jobs[j], &cCrossJob::Run);
+  }
+  jobbatch.RunBatch();
+
+  total_dist = 0;
+  total_count = 0;
+  for (int j = 0; j < num_jobs; j++) {
+    total_dist += jobs[j]->GetTotalDist();
+    total_count += jobs[j]->GetTotalCount();
+    delete jobs[j];
+  }
+}
@@ -0,0 +1,103 @@
+/*
+ *  cPairwiseDistances.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cPairwiseDistances_h
+#define cPairwiseDistances_h
+
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+#ifndef tList_h
+#include "tList.h"
+#endif
+
+#include <iostream>
+
+namespace Avida {
+  class Sequence;
+};
+
+class cAnalyzeGenotype;
+class cAnalyzeJobQueue;
+class cAvidaContext;
+
+using namespace Avida;
+
+
+// All-pairs genetic distance engine for analyze mode.  The upper triangle of the pair matrix is cut into square tiles of
+// genotypes that are processed as jobs on the analyze job queue.  Results are reduced in tile order, so all outputs
+// are independent of the number of worker threads.
+class cPairwiseDistances
+{
+public:
+  enum eMetric { EDIT_DISTANCE, HAMMING_DISTANCE };
+
+  struct sSummary
+  {
+    long long pair_count;        // organism pairs, weighted by the number of CPUs of each genotype
+    long long dist_total;        // sum of distances over all organism pairs
+    int dist_max;
+    long long threshold_pairs;   // organism pairs at or above the distance threshold
+
+    sSummary() : pair_count(0), dist_total(0), dist_max(0), threshold_pairs(0) { ; }
+  };
+
+private:
+  class cTileJob;
+  class cNearestJob;
+  class cCrossJob;
+
+  cAnalyzeJobQueue& m_jobqueue;
+  eMetric m_metric;
+  tArray<cAnalyzeGenotype*> m_genotypes;
+  tArray<const Sequence*> m_seqs;
+
+
+  cPairwiseDistances(); // @not_implemented
+  cPairwiseDistances(const cPairwiseDistances&); // @not_implemented
+  cPairwiseDistances& operator=(const cPairwiseDistances&); // @not_implemented
+
+  int distance(const Sequence& seq1, const Sequence& seq2, int threshold) const;
+  int distance(int i, int j, int threshold) const { return distance(*m_seqs[i], *m_seqs[j], threshold); }
+
+public:
+  cPairwiseDistances(cAnalyzeJobQueue& jobqueue, tList<cAnalyzeGenotype>& genotypes, eMetric metric = EDIT_DISTANCE);
+
+  int GetSize() const { return m_genotypes.GetSize(); }
+
+  // Exact distance statistics over all pairs of organisms in the batch
+  void CalcSummary(int threshold, sSummary& summary);
+
+  // Writes the upper triangle of the genotype distance matrix as little-endian 16-bit values, row by row.  Distances
+  // at or above cap (or 65535) are stored as the cap, which lets every pair stop as soon as it reaches it.  Only one
+  // band of rows is held in memory at a time.
+  void WriteMatrix(std::ostream& fp, int cap);
+
+  // Writes the k nearest genotypes to each genotype, one "id neighbor_id distance" line per neighbor.  Neighbors at or
+  // above max_dist (when positive) are dropped.  Each comparison stops early once it cannot beat the current kth
+  // neighbor.
+  void WriteNearest(std::ostream& fp, int k, int max_dist);
+
+  // Organism weighted distance totals between every genotype of this set and every genotype of other_set
+  void CalcCrossTotals(cPairwiseDistances& other_set, long& total_dist, long& total_count);
+};
+
+#endif
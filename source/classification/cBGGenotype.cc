@@ -29,6 +29,114 @@
 #include "cStringUtil.h"
 #include "cWorld.h"
 #include "tDictionary.h"
+#include "tSmartArray.h"
+
+
+// Historic sequence deltas are byte streams opening with a kind byte.  DELTA_FULL is followed by the length and every
+// instruction op.  The edit kinds give the lengths of the prefix and suffix shared with the parent sequence, then the
+// differing middle, either as its length and ops (DELTA_RAW) or, when the middle is the same length in both sequences,
+// as a count of (gap, op) substitutions (DELTA_SUBST).  Lengths, counts and gaps use 7 bits per byte.
+enum { DELTA_FULL = 0, DELTA_RAW, DELTA_SUBST };
+
+static void writeDeltaInt(tSmartArray<unsigned char>& out, int value)
+{
+  while (value >= 0x80) {
+    out.Push((unsigned char)((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.Push((unsigned char)value);
+}
+
+static int readDeltaInt(const tArray<unsigned char>& in, int& pos)
+{
+  int value = 0;
+  for (int shift = 0; ; shift += 7) {
+    const unsigned char byte = in[pos++];
+    value |= (byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return value;
+  }
+}
+
+static void encodeFullSequence(const Sequence& seq, tSmartArray<unsigned char>& out)
+{
+  out.Push(DELTA_FULL);
+  writeDeltaInt(out, seq.GetSize());
+  for (int i = 0; i < seq.GetSize(); i++) out.Push((unsigned char)seq[i].GetOp());
+}
+
+static void encodeSequenceDelta(const Sequence& base, const Sequence& seq, tSmartArray<unsigned char>& out)
+{
+  const int base_size = base.GetSize();
+  const int size = seq.GetSize();
+  
+  int prefix = 0;
+  while (prefix < base_size && prefix < size && base[prefix] == seq[prefix]) prefix++;
+  int suffix = 0;
+  while (suffix < base_size - prefix && suffix < size - prefix &&
+         base[base_size - suffix - 1] == seq[size - suffix - 1]) suffix++;
+  
+  const int mid_end = size - suffix;
+  int num_subst = -1;
+  if (base_size == size) {
+    num_subst = 0;
+    for (int i = prefix; i < mid_end; i++) if (base[i] != seq[i]) num_subst++;
+  }
+  
+  // Substitutions cost about two bytes each, so fall back to raw ops for densely mutated middles
+  if (num_subst >= 0 && num_subst * 2 <= mid_end - prefix) {
+    out.Push(DELTA_SUBST);
+    writeDeltaInt(out, prefix);
+    writeDeltaInt(out, suffix);
+    writeDeltaInt(out, num_subst);
+    int last = prefix;
+    for (int i = prefix; i < mid_end; i++) {
+      if (base[i] == seq[i]) continue;
+      writeDeltaInt(out, i - last);
+      out.Push((unsigned char)seq[i].GetOp());
+      last = i;
+    }
+  } else {
+    out.Push(DELTA_RAW);
+    writeDeltaInt(out, prefix);
+    writeDeltaInt(out, suffix);
+    writeDeltaInt(out, mid_end - prefix);
+    for (int i = prefix; i < mid_end; i++) out.Push((unsigned char)seq[i].GetOp());
+  }
+}
+
+// Rebuild a sequence in place, seq holding the parent sequence on entry for the edit kinds
+static void applySequenceDelta(const tArray<unsigned char>& delta, Sequence& seq)
+{
+  int pos = 0;
+  const int kind = delta[pos++];
+  
+  if (kind == DELTA_FULL) {
+    Sequence full(readDeltaInt(delta, pos));
+    for (int i = 0; i < full.GetSize(); i++) full[i].SetOp(delta[pos++]);
+    seq = full;
+    return;
+  }
+  
+  const int prefix = readDeltaInt(delta, pos);
+  const int suffix = readDeltaInt(delta, pos);
+  
+  if (kind == DELTA_SUBST) {
+    const int num_subst = readDeltaInt(delta, pos);
+    int site = prefix;
+    for (int i = 0; i < num_subst; i++) {
+      site += readDeltaInt(delta, pos);
+      seq[site].SetOp(delta[pos++]);
+    }
+    return;
+  }
+  
+  const int mid = readDeltaInt(delta, pos);
+  Sequence edited(prefix + mid + suffix);
+  for (int i = 0; i < prefix; i++) edited[i] = seq[i];
+  for (int i = 0; i < mid; i++) edited[prefix + i].SetOp(delta[pos++]);
+  for (int i = 0; i < suffix; i++) edited[prefix + mid + i] = seq[seq.GetSize() - suffix + i];
+  seq = edited;
+}
 
 
 cBGGenotype::cBGGenotype(cBGGenotypeManager* mgr, int in_id, cBioUnit* founder, int update, tArray<cBioGroup*>* parents)
@@ -38,9 +146,13 @@ cBGGenotype::cBGGenotype(cBGGenotypeManager* mgr, int in_id, cBioUnit* founder,
   , m_src(founder->GetUnitSource())
   , m_src_args(founder->GetUnitSourceArgs())
   , m_genome(founder->GetGenome())
+  , m_genome_hash(0)
   , m_name("001-no_name")
   , m_threshold(false)
   , m_active(true)
+  , m_packed(false)
+  , m_rehydrated(false)
+  , m_stats(new sStats)
   , m_generation_born(founder->GetPhenotype().GetGeneration())
   , m_update_born(update)
   , m_update_deactivated(-1)
@@ -64,7 +176,7 @@ cBGGenotype::cBGGenotype(cBGGenotypeManager* mgr, int in_id, cBioUnit* founder,
     }
   }
   if (m_parents.GetSize()) m_depth = m_parents[0]->GetDepth() + 1;
-  if (m_src != SRC_ORGANISM_FILE_LOAD) m_breed_in.Inc();
+  if (m_src != SRC_ORGANISM_FILE_LOAD) m_stats->breed_in.Inc();
   m_name.Set("%03d-no_name", m_genome.GetSequence().GetSize());
 }
 
@@ -73,9 +185,13 @@ cBGGenotype::cBGGenotype(cBGGenotypeManager* mgr, int in_id, const tDictionary<c
 : cBioGroup(in_id)
 , m_mgr(mgr)
 , m_handle(NULL)
+, m_genome_hash(0)
 , m_name("001-no_name")
 , m_threshold(false)
 , m_active(false)
+, m_packed(false)
+, m_rehydrated(false)
+, m_stats(new sStats)
 , m_active_offspring_genotypes(0)
 , m_num_organisms(0)
 , m_last_num_organisms(0)
@@ -126,6 +242,8 @@ cBGGenotype::cBGGenotype(cBGGenotypeManager* mgr, int in_id, const tDictionary<c
 
 cBGGenotype::~cBGGenotype()
 {
+  if (m_packed) m_mgr->ReleaseHistoric(m_historic);
+  else delete m_stats;
   delete m_handle;
   m_parents.Resize(0);
 }
@@ -144,10 +262,10 @@ const cString& cBGGenotype::GetRole() const
 
 cBioGroup* cBGGenotype::ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGroup*>* parents)
 {
-  m_births.Inc();
+  m_stats->births.Inc();
   
   if (Matches(bu)) {
-    m_breed_true.Inc();
+    m_stats->breed_true.Inc();
     m_total_organisms++;
     m_num_organisms++;
     m_mgr->AdjustGenotype(this, m_num_organisms - 1, m_num_organisms);
@@ -155,7 +273,7 @@ cBioGroup* cBGGenotype::ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGroup*>* par
     return this;
   }  
   
-  m_breed_out.Inc();
+  m_stats->breed_out.Inc();
   return m_mgr->ClassifyNewBioUnit(bu, parents);
 }
 
@@ -163,18 +281,18 @@ void cBGGenotype::HandleBioUnitGestation(cBioUnit* bu)
 {
   const cPhenotype& phenotype = bu->GetPhenotype();
   
-  m_copied_size.Add(phenotype.GetCopiedSize());
-  m_exe_size.Add(phenotype.GetExecutedSize());
-  m_gestation_time.Add(phenotype.GetGestationTime());
-  m_repro_rate.Add(1.0 / phenotype.GetGestationTime());
-  m_merit.Add(phenotype.GetMerit().GetDouble());
-  m_fitness.Add(phenotype.GetFitness());
+  m_stats->copied_size.Add(phenotype.GetCopiedSize());
+  m_stats->exe_size.Add(phenotype.GetExecutedSize());
+  m_stats->gestation_time.Add(phenotype.GetGestationTime());
+  m_stats->repro_rate.Add(1.0 / phenotype.GetGestationTime());
+  m_stats->merit.Add(phenotype.GetMerit().GetDouble());
+  m_stats->fitness.Add(phenotype.GetFitness());
 }
 
 
 void cBGGenotype::RemoveBioUnit(cBioUnit* bu)
 {
-  m_deaths.Inc();
+  m_stats->deaths.Inc();
   
   // Remove active reference
   m_a_refs--;
@@ -217,15 +335,15 @@ void cBGGenotype::Save(cDataFile& df)
   
   df.Write(m_num_organisms, "Number of currently living organisms", "num_units");
   df.Write(m_total_organisms, "Total number of organisms that ever existed", "total_units");
-  df.Write(m_genome.GetSequence().GetSize(), "Genome Length", "length");
-  df.Write(m_merit.Average(), "Average Merit", "merit");
-  df.Write(m_gestation_time.Average(), "Average Gestation Time", "gest_time");
-  df.Write(m_fitness.Average(), "Average Fitness", "fitness");
+  df.Write(GetGenome().GetSequence().GetSize(), "Genome Length", "length");
+  df.Write(GetMerit(), "Average Merit", "merit");
+  df.Write(GetGestationTime(), "Average Gestation Time", "gest_time");
+  df.Write(GetFitness(), "Average Fitness", "fitness");
   df.Write(m_generation_born, "Generation Born", "gen_born");
   df.Write(m_update_born, "Update Born", "update_born");
   df.Write(m_update_deactivated, "Update Deactivated", "update_deactivated");
   df.Write(m_depth, "Phylogenetic Depth", "depth");
-  m_genome.Save(df);
+  GetGenome().Save(df);
 }
 
 
@@ -330,7 +448,7 @@ void cBGGenotype::NotifyNewBioUnit(cBioUnit* bu)
       
     case SRC_ORGANISM_DIVIDE:
     case SRC_PARASITE_INJECT:
-      m_breed_in.Inc();
+      m_stats->breed_in.Inc();
       break;
       
     default:
@@ -346,9 +464,99 @@ void cBGGenotype::NotifyNewBioUnit(cBioUnit* bu)
 void cBGGenotype::UpdateReset()
 {
   m_last_num_organisms = m_num_organisms;
-  m_births.Next();
-  m_deaths.Next();
-  m_breed_out.Next();
-  m_breed_true.Next();
-  m_breed_in.Next();
+  m_stats->births.Next();
+  m_stats->deaths.Next();
+  m_stats->breed_out.Next();
+  m_stats->breed_true.Next();
+  m_stats->breed_in.Next();
+}
+
+
+// Collapse the tracking data and genome sites into a historic record
+void cBGGenotype::pack(sHistoric* record)
+{
+  assert(!m_packed);
+  
+  record->sums[HS_COPIED_SIZE] = m_stats->copied_size.Sum();
+  record->sums[HS_EXE_SIZE] = m_stats->exe_size.Sum();
+  record->sums[HS_GESTATION_TIME] = m_stats->gestation_time.Sum();
+  record->sums[HS_REPRO_RATE] = m_stats->repro_rate.Sum();
+  record->sums[HS_MERIT] = m_stats->merit.Sum();
+  record->sums[HS_FITNESS] = m_stats->fitness.Sum();
+  record->samples = m_stats->copied_size.N();  // every gestation adds to all of the sums
+  
+  const Sequence& seq = m_genome.GetSequence();
+  tSmartArray<unsigned char> delta;
+  if (m_parents.GetSize() && (m_depth % nBGGenotypeManager::HISTORIC_KEYFRAME_DEPTH)) {
+    Sequence base;
+    m_parents[0]->unpackSequence(base);
+    encodeSequenceDelta(base, seq, delta);
+  }
+  if (delta.GetSize() == 0 || delta.GetSize() > seq.GetSize() + 1) {
+    delta.Resize(0);
+    encodeFullSequence(seq, delta);
+  }
+  record->seq_delta.ResizeClear(delta.GetSize());
+  for (int i = 0; i < delta.GetSize(); i++) record->seq_delta[i] = delta[i];
+  
+  delete m_stats;
+  m_historic = record;
+  m_packed = true;
+  m_rehydrated = false;
+  m_genome.GetSequence() = Sequence();
+}
+
+
+// Restore full tracking data and genome sites, returning the historic record for the manager to reclaim.  The sums
+// are restored as a single weighted sample, so averages carry over (to rounding) while the variance does not.
+cBGGenotype::sHistoric* cBGGenotype::unpack()
+{
+  assert(m_packed);
+  
+  if (!m_rehydrated) rehydrate();
+  
+  sHistoric* record = m_historic;
+  sStats* stats = new sStats;
+  if (record->samples > 0.0) {
+    const double n = record->samples;
+    stats->copied_size.Add(record->sums[HS_COPIED_SIZE] / n, n);
+    stats->exe_size.Add(record->sums[HS_EXE_SIZE] / n, n);
+    stats->gestation_time.Add(record->sums[HS_GESTATION_TIME] / n, n);
+    stats->repro_rate.Add(record->sums[HS_REPRO_RATE] / n, n);
+    stats->merit.Add(record->sums[HS_MERIT] / n, n);
+    stats->fitness.Add(record->sums[HS_FITNESS] / n, n);
+  }
+  
+  m_stats = stats;
+  m_packed = false;
+  m_rehydrated = false;
+  return record;
+}
+
+
+void cBGGenotype::unpackSequence(Sequence& seq) const
+{
+  if (!m_packed || m_rehydrated) {
+    seq = m_genome.GetSequence();
+    return;
+  }
+  
+  if (m_historic->seq_delta[0] != DELTA_FULL) m_parents[0]->unpackSequence(seq);
+  applySequenceDelta(m_historic->seq_delta, seq);
+}
+
+
+void cBGGenotype::rehydrate() const
+{
+  assert(m_packed && !m_rehydrated);
+  unpackSequence(m_genome.GetSequence());
+  m_rehydrated = true;
+}
+
+
+void cBGGenotype::releaseRehydrated()
+{
+  assert(m_packed && m_rehydrated);
+  m_genome.GetSequence() = Sequence();
+  m_rehydrated = false;
 }
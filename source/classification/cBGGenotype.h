@@ -45,14 +45,54 @@ private:
   cBGGenotypeManager* m_mgr;
   cEntryHandle* m_handle;
   
+  // Birth and performance tracking, allocated while the genotype is active
+  struct sStats
+  {
+    cCountTracker births;
+    cCountTracker deaths;
+    cCountTracker breed_in;
+    cCountTracker breed_true;
+    cCountTracker breed_out;
+    
+    cDoubleSum copied_size;
+    cDoubleSum exe_size;
+    cDoubleSum gestation_time;
+    cDoubleSum repro_rate;
+    cDoubleSum merit;
+    cDoubleSum fitness;
+  };
+  
+public:
+  enum eHistoricSum { HS_COPIED_SIZE = 0, HS_EXE_SIZE, HS_GESTATION_TIME, HS_REPRO_RATE, HS_MERIT, HS_FITNESS, NUM_HS };
+  
+  // Fixed size record that stands in for sStats and the genome sites once the genotype is historic.  Only the sums
+  // behind the reported averages are kept, and the sequence is stored as an edit of the first parent's sequence (or in
+  // full for founders and every HISTORIC_KEYFRAME_DEPTH levels, bounding the chain walked to rebuild it).  Records are
+  // handed out by the genotype manager's historic arena.
+  struct sHistoric
+  {
+    double sums[NUM_HS];
+    double samples;
+    tArray<unsigned char> seq_delta;
+  };
+  
+private:
   eBioUnitSource m_src;
   cString m_src_args;
-  Genome m_genome;
+  mutable Genome m_genome;            // sites are released while packed, and restored on demand by GetGenome()
+  unsigned long long m_genome_hash;   // set by the genotype manager while the genotype is active
   cString m_name;
     
   struct {
     bool m_threshold:1;
     bool m_active:1;
+    bool m_packed:1;                  // m_historic (rather than m_stats) is valid, see cBGGenotypeManager::removeGenotype
+    mutable bool m_rehydrated:1;      // packed, but the genome sites have been rebuilt for a caller
+  };
+  
+  union {
+    sStats* m_stats;
+    sHistoric* m_historic;
   };
   
   int m_generation_born;
@@ -66,19 +106,6 @@ private:
   
   tArray<cBGGenotype*> m_parents;
   cString m_parent_str;
-  
-  cCountTracker m_births;
-  cCountTracker m_deaths;
-  cCountTracker m_breed_in;
-  cCountTracker m_breed_true;
-  cCountTracker m_breed_out;
-
-  cDoubleSum m_copied_size;
-  cDoubleSum m_exe_size;
-  cDoubleSum m_gestation_time;
-  cDoubleSum m_repro_rate;
-  cDoubleSum m_merit;
-  cDoubleSum m_fitness;
     
   int m_last_birth_cell;
   int m_last_group_id;
@@ -87,6 +114,15 @@ private:
   cBGGenotype(cBGGenotypeManager* mgr, int in_id, cBioUnit* founder, int update, tArray<cBioGroup*>* parents);
   cBGGenotype(cBGGenotypeManager* mgr, int in_id, const tDictionary<cString>& props, cWorld* world);
   
+  void pack(sHistoric* record);
+  sHistoric* unpack();
+  void unpackSequence(Sequence& seq) const;
+  void rehydrate() const;
+  void releaseRehydrated();
+  
+  inline double historicAverage(eHistoricSum sum) const
+    { return (m_historic->samples > 0.0) ? (m_historic->sums[sum] / m_historic->samples) : 0.0; }
+  
 public:
   ~cBGGenotype();
   
@@ -116,8 +152,8 @@ public:
   inline bool IsParasite() const { return (m_src == SRC_PARASITE_INJECT || m_src == SRC_PARASITE_FILE_LOAD); }
   inline eBioUnitSource GetSource() const { return m_src; }
   inline const cString& GetSourceArgs() const { return m_src_args; }
-  inline const Genome& GetGenome() const { return m_genome; }
-  inline cString GetGenomeString() const { return m_genome.AsString(); }
+  inline const Genome& GetGenome() const { if (m_packed && !m_rehydrated) rehydrate(); return m_genome; }
+  inline cString GetGenomeString() const { return GetGenome().AsString(); }
   
   inline const cString& GetName() const { return m_name; }
   inline void SetName(const cString& name) { m_name = name; }
@@ -139,23 +175,28 @@ public:
   
   inline int GetTotalOrganisms() const { return m_total_organisms; }
   
-  inline int GetLastBirths() const { return m_births.GetLast(); }
-  inline int GetLastBreedIn() const { return m_breed_in.GetLast(); }
-  inline int GetLastBreedTrue() const { return m_breed_true.GetLast(); }
-  inline int GetLastBreedOut() const { return m_breed_out.GetLast(); }
-  
-  inline int GetThisBirths() const { return m_births.GetCur(); }
-  inline int GetThisDeaths() const { return m_deaths.GetCur(); }
-  inline int GetThisBreedIn() const { return m_breed_in.GetCur(); }
-  inline int GetThisBreedTrue() const { return m_breed_true.GetCur(); }
-  inline int GetThisBreedOut() const { return m_breed_out.GetCur(); }
-  
-  inline double GetCopiedSize() const { return m_copied_size.Average(); }
-  inline double GetExecutedSize() const { return m_exe_size.Average(); }
-  inline double GetGestationTime() const { return m_gestation_time.Average(); }
-  inline double GetReproRate() const { return m_repro_rate.Average(); }
-  inline double GetMerit() const { return m_merit.Average(); }
-  inline double GetFitness() const { return m_fitness.Average(); }
+  // Historic genotypes keep no per-update counts
+  inline int GetLastBirths() const { return (m_packed) ? 0 : m_stats->births.GetLast(); }
+  inline int GetLastBreedIn() const { return (m_packed) ? 0 : m_stats->breed_in.GetLast(); }
+  inline int GetLastBreedTrue() const { return (m_packed) ? 0 : m_stats->breed_true.GetLast(); }
+  inline int GetLastBreedOut() const { return (m_packed) ? 0 : m_stats->breed_out.GetLast(); }
+  
+  inline int GetThisBirths() const { return (m_packed) ? 0 : m_stats->births.GetCur(); }
+  inline int GetThisDeaths() const { return (m_packed) ? 0 : m_stats->deaths.GetCur(); }
+  inline int GetThisBreedIn() const { return (m_packed) ? 0 : m_stats->breed_in.GetCur(); }
+  inline int GetThisBreedTrue() const { return (m_packed) ? 0 : m_stats->breed_true.GetCur(); }
+  inline int GetThisBreedOut() const { return (m_packed) ? 0 : m_stats->breed_out.GetCur(); }
+  
+  inline double GetCopiedSize() const
+    { return (m_packed) ? historicAverage(HS_COPIED_SIZE) : m_stats->copied_size.Average(); }
+  inline double GetExecutedSize() const
+    { return (m_packed) ? historicAverage(HS_EXE_SIZE) : m_stats->exe_size.Average(); }
+  inline double GetGestationTime() const
+    { return (m_packed) ? historicAverage(HS_GESTATION_TIME) : m_stats->gestation_time.Average(); }
+  inline double GetReproRate() const
+    { return (m_packed) ? historicAverage(HS_REPRO_RATE) : m_stats->repro_rate.Average(); }
+  inline double GetMerit() const { return (m_packed) ? historicAverage(HS_MERIT) : m_stats->merit.Average(); }
+  inline double GetFitness() const { return (m_packed) ? historicAverage(HS_FITNESS) : m_stats->fitness.Average(); }
   
   inline int GetLastBirthCell() const { return m_last_birth_cell; }
   inline int GetLastGroupID() const { return m_last_group_id; } 
@@ -38,6 +38,8 @@ using namespace AvidaTools;
 
 cBGGenotypeManager::cBGGenotypeManager(cWorld* world)
   : m_world(world)
+  , m_active_table(false)
+  , m_id_table(true)
   , m_active_sz(1)
   , m_coalescent(NULL)
   , m_best(0)
@@ -67,20 +69,25 @@ cBioGroup* cBGGenotypeManager::ClassifyNewBioUnit(cBioUnit* bu, tArrayMap<cStrin
 
 void cBGGenotypeManager::UpdateReset()
 {
-  if (m_active_sz.GetSize() < nBGGenotypeManager::HASH_SIZE) {
+  if (m_active_sz.GetSize() < m_active_table.GetCapacity()) {
     for (int i = 0; i < m_active_sz.GetSize(); i++) {
       tAutoRelease<tIterator<cBGGenotype> > list_it(m_active_sz[i].Iterator());
       while (list_it->Next() != NULL) if (list_it->Get()->IsThreshold()) list_it->Get()->UpdateReset();
     }
   } else {
-    for (int i = 0; i < nBGGenotypeManager::HASH_SIZE; i++) {
-      tAutoRelease<tIterator<cBGGenotype> > list_it(m_active_hash[i].Iterator());
-      while (list_it->Next() != NULL) if (list_it->Get()->IsThreshold()) list_it->Get()->UpdateReset();
+    for (int i = 0; i < m_active_table.GetCapacity(); i++) {
+      cBGGenotype* bg = m_active_table.GetSlot(i);
+      if (bg && bg->IsThreshold()) bg->UpdateReset();
     }    
   }
 
+  // Drop unreferenced historic genotypes, and the sites of any that were rehydrated since the last update
   tAutoRelease<tIterator<cBGGenotype> > list_it(m_historic.Iterator());
-  while (list_it->Next() != NULL) if (!list_it->Get()->GetReferenceCount()) this->removeGenotype(list_it->Get());
+  while (list_it->Next() != NULL) {
+    cBGGenotype* bg = list_it->Get();
+    if (!bg->GetReferenceCount()) this->removeGenotype(bg);
+    else if (bg->m_rehydrated) bg->releaseRehydrated();
+  }
 }
 
 
@@ -198,14 +205,11 @@ void cBGGenotypeManager::UpdateStats(cStats& stats)
 
 cBioGroup* cBGGenotypeManager::GetBioGroup(int bg_id)
 {
-  for (int i = m_best; i >= 0; i--) {
-    tAutoRelease<tIterator<cBGGenotype> > list_it(m_active_sz[i].Iterator());
-    while (list_it->Next() != NULL) if (list_it->Get()->GetID() == bg_id) return list_it->Get();
+  cBGGenotype* bg = NULL;
+  for (int slot = m_id_table.FirstSlot(bg_id); (bg = m_id_table.GetSlot(slot)) != NULL; slot = m_id_table.NextSlot(slot)) {
+    if (bg->GetID() == bg_id) return bg;
   }
   
-  tAutoRelease<tIterator<cBGGenotype> > list_it(m_historic.Iterator());
-  while (list_it->Next() != NULL) if (list_it->Get()->GetID() == bg_id) return list_it->Get();
-  
   return NULL;
 }
 
@@ -214,6 +218,8 @@ cBioGroup* cBGGenotypeManager::LoadBioGroup(const tDictionary<cString>& props)
 {
   cBGGenotype* bg = new cBGGenotype(this, m_next_id++, props, m_world); 
   m_historic.Push(bg, &bg->m_handle);
+  m_id_table.Insert(bg);
+  bg->pack(m_historic_arena.Alloc());
   return bg;
 }
 
@@ -244,57 +250,35 @@ tIterator<cBioGroup>* cBGGenotypeManager::Iterator()
 
 cBGGenotype* cBGGenotypeManager::ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGroup*>* parents, tArrayMap<cString, cString>* hints)
 {
-  int list_num = hashGenome(bu->GetGenome().GetSequence());
+  const unsigned long long genome_hash = hashGenome(bu->GetGenome().GetSequence());
   
   cBGGenotype* found = NULL;
 
   cString gid_str;
   if (hints && hints->Get("id", gid_str)) {
-    int gid = gid_str.AsInt();
-    
-    // Search all lists attempting to locate the referenced genotype by ID
-    for (int i = 0; i < m_active_sz.GetSize() && !found; i++) {
-      tAutoRelease<tIterator<cBGGenotype> > list_it(m_active_sz[i].Iterator());
-      while (list_it->Next() != NULL) {
-        if (list_it->Get()->GetID() == gid) {
-          found = list_it->Get();
-          found->NotifyNewBioUnit(bu);
-          break;
-        }
-      }
-    }
+    // Locate the referenced genotype, active or historic, by ID
+    found = static_cast<cBGGenotype*>(GetBioGroup(gid_str.AsInt()));
     
-    if (!found) {
-      tAutoRelease<tIterator<cBGGenotype> > list_it(m_historic.Iterator());
-      while (list_it->Next() != NULL) {
-        if (list_it->Get()->GetID() == gid) {
-          found = list_it->Get();
-          m_active_hash[hashGenome(found->GetGenome().GetSequence())].Push(found);
-          found->m_handle->Remove(); // Remove from historic list
-          m_active_sz[found->GetNumUnits()].PushRear(found, &found->m_handle);
-          found->NotifyNewBioUnit(bu);
-          m_world->GetStats().AddGenotype();
-          if (found->GetNumUnits() > m_best) {
-            m_best = found->GetNumUnits();
-            found->SetThreshold();
-            found->SetName(nameGenotype(found->GetGenome().GetSequence().GetSize()));
-            NotifyListeners(found, BG_EVENT_ADD_THRESHOLD);
-          }          
-        }
-      }
+    if (found && found->IsActive()) {
+      found->NotifyNewBioUnit(bu);
+    } else if (found) {
+      found->m_handle->Remove(); // Remove from historic list
+      activateGenotype(found);
+      found->NotifyNewBioUnit(bu);
+      m_world->GetStats().AddGenotype();
+      if (found->GetNumUnits() > m_best) {
+        m_best = found->GetNumUnits();
+        found->SetThreshold();
+        found->SetName(nameGenotype(found->GetGenome().GetSequence().GetSize()));
+        NotifyListeners(found, BG_EVENT_ADD_THRESHOLD);
+      }          
     }
   } 
   
   // No hints or unable to locate hinted genome, search for a matching genotype
   if (!found) {
-    tAutoRelease<tIterator<cBGGenotype> > list_it(m_active_hash[list_num].Iterator());
-    while (list_it->Next() != NULL) {
-      if (list_it->Get()->Matches(bu)) {
-        found = list_it->Get();
-        found->NotifyNewBioUnit(bu);
-        break;
-      }
-    }
+    found = findActive(bu, genome_hash);
+    if (found) found->NotifyNewBioUnit(bu);
   }
   
   // No matching genotype (hinted or otherwise), so create a new one
@@ -306,7 +290,9 @@ cBGGenotype* cBGGenotypeManager::ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGro
     } else { //It's disabled, so toss the parents
       found = new cBGGenotype(this, m_next_id++, bu, m_world->GetStats().GetUpdate(), NULL);
     }
-    m_active_hash[list_num].Push(found);
+    found->m_genome_hash = genome_hash;
+    m_active_table.Insert(found);
+    m_id_table.Insert(found);
     resizeActiveList(found->GetNumUnits());
     m_active_sz[found->GetNumUnits()].PushRear(found, &found->m_handle);
     m_world->GetStats().AddGenotype();
@@ -322,6 +308,27 @@ cBGGenotype* cBGGenotypeManager::ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGro
 }
 
 
+cBGGenotype* cBGGenotypeManager::findActive(cBioUnit* bu, unsigned long long genome_hash) const
+{
+  cBGGenotype* bg = NULL;
+  for (int slot = m_active_table.FirstSlot(genome_hash); (bg = m_active_table.GetSlot(slot)) != NULL;
+       slot = m_active_table.NextSlot(slot)) {
+    if (bg->m_genome_hash == genome_hash && bg->Matches(bu)) return bg;
+  }
+  return NULL;
+}
+
+
+// Move a historic genotype back into the active lists (the caller has already unlinked it from m_historic)
+void cBGGenotypeManager::activateGenotype(cBGGenotype* genotype)
+{
+  if (genotype->m_packed) m_historic_arena.Free(genotype->unpack());
+  genotype->m_genome_hash = hashGenome(genotype->GetGenome().GetSequence());
+  m_active_table.Insert(genotype);
+  m_active_sz[genotype->GetNumUnits()].PushRear(genotype, &genotype->m_handle);
+}
+
+
 void cBGGenotypeManager::AdjustGenotype(cBGGenotype* genotype, int old_size, int new_size)
 {
   // Remove from old size list
@@ -384,15 +391,20 @@ cFlexVar cBGGenotypeManager::GetBioGroupProperty(const cBGGenotype* genotype, co
 
 
 
-unsigned int cBGGenotypeManager::hashGenome(const Sequence& genome) const
+// Sequence's polynomial hash (cached on the genome and maintained through mutation), with the length folded in and the
+// result passed through a 64-bit finalizer so that every bit of the table index depends on every site.
+unsigned long long cBGGenotypeManager::hashGenome(const Sequence& genome) const
 {
-  unsigned int total = 0;
+  unsigned long long total = genome.GetHash();
   
-  for (int i = 0; i < genome.GetSize(); i++) {
-    total += (genome[i].GetOp() + 3) * i;
-  }
+  total ^= (unsigned long long)genome.GetSize() << 48;
+  total ^= total >> 33;
+  total *= 0xFF51AFD7ED558CCDULL;
+  total ^= total >> 33;
+  total *= 0xC4CEB9FE1A85EC53ULL;
+  total ^= total >> 33;
   
-  return total % nBGGenotypeManager::HASH_SIZE;
+  return total;
 }
 
 cString cBGGenotypeManager::nameGenotype(int size)
@@ -416,8 +428,7 @@ void cBGGenotypeManager::removeGenotype(cBGGenotype* genotype)
   if (genotype->GetActiveReferenceCount()) return;    
   
   if (genotype->IsActive()) {
-    int list_num = hashGenome(genotype->GetGenome().GetSequence());
-    m_active_hash[list_num].Remove(genotype);
+    m_active_table.Remove(genotype);
     genotype->Deactivate(m_world->GetStats().GetUpdate());
     //@CHC: If classification of historical genotypes is turned off, then we'll
     //      just skip the step of adding a removed genotype to the historic list.
@@ -425,6 +436,8 @@ void cBGGenotypeManager::removeGenotype(cBGGenotype* genotype)
     //      will not be correct
     if (!m_world->GetConfig().DISABLE_GENOTYPE_CLASSIFICATION.Get()) {
       m_historic.Push(genotype, &genotype->m_handle);
+    } else {
+      m_id_table.Remove(genotype);
     }
   }
 
@@ -433,7 +446,11 @@ void cBGGenotypeManager::removeGenotype(cBGGenotype* genotype)
     genotype->ClearThreshold();
   }
   
-  if (genotype->GetPassiveReferenceCount()) return;
+  // Still referenced (by descendants or demes), so keep it, packed down to its historic record
+  if (genotype->GetPassiveReferenceCount()) {
+    if (!genotype->m_packed) genotype->pack(m_historic_arena.Alloc());
+    return;
+  }
   
   const tArray<cBGGenotype*>& parents = genotype->GetParents();
   for (int i = 0; i < parents.GetSize(); i++) {
@@ -446,6 +463,7 @@ void cBGGenotypeManager::removeGenotype(cBGGenotype* genotype)
   
   assert(genotype->m_handle);
   genotype->m_handle->Remove(); // Remove from historic list
+  m_id_table.Remove(genotype);
   delete genotype;
 }
 
@@ -522,3 +540,76 @@ cBioGroup* cBGGenotypeManager::cGenotypeIterator::Next()
   
   return m_it->Get();
 }
+
+
+inline unsigned long long cBGGenotypeManager::cGenotypeTable::keyOf(const cBGGenotype* bg) const
+{
+  return (m_by_id) ? (unsigned long long)bg->GetID() : bg->m_genome_hash;
+}
+
+void cBGGenotypeManager::cGenotypeTable::Insert(cBGGenotype* bg)
+{
+  if ((m_count + 1) * 2 > m_slots.GetSize()) resize(m_slots.GetSize() * 2);
+  
+  int slot = FirstSlot(keyOf(bg));
+  while (m_slots[slot] != NULL) slot = NextSlot(slot);
+  m_slots[slot] = bg;
+  m_count++;
+}
+
+bool cBGGenotypeManager::cGenotypeTable::Remove(cBGGenotype* bg)
+{
+  int slot = FirstSlot(keyOf(bg));
+  while (m_slots[slot] != bg) {
+    if (m_slots[slot] == NULL) return false;
+    slot = NextSlot(slot);
+  }
+  
+  // Shift back any entry further along the cluster whose home slot does not lie (cyclically) between the hole and it
+  int hole = slot;
+  m_slots[hole] = NULL;
+  for (int cur = NextSlot(hole); m_slots[cur] != NULL; cur = NextSlot(cur)) {
+    const int home = FirstSlot(keyOf(m_slots[cur]));
+    const bool stays = (hole <= cur) ? (hole < home && home <= cur) : (hole < home || home <= cur);
+    if (!stays) {
+      m_slots[hole] = m_slots[cur];
+      m_slots[cur] = NULL;
+      hole = cur;
+    }
+  }
+  
+  m_count--;
+  return true;
+}
+
+
+cBGGenotypeManager::cHistoricArena::~cHistoricArena()
+{
+  for (int i = 0; i < m_blocks.GetSize(); i++) delete [] m_blocks[i];
+}
+
+cBGGenotype::sHistoric* cBGGenotypeManager::cHistoricArena::Alloc()
+{
+  if (m_free.GetSize() == 0) {
+    cBGGenotype::sHistoric* block = new cBGGenotype::sHistoric[nBGGenotypeManager::HISTORIC_BLOCK_SIZE];
+    m_blocks.Push(block);
+    for (int i = nBGGenotypeManager::HISTORIC_BLOCK_SIZE - 1; i >= 0; i--) m_free.Push(&block[i]);
+  }
+  
+  return m_free.Pop();
+}
+
+void cBGGenotypeManager::cHistoricArena::Free(cBGGenotype::sHistoric* record)
+{
+  record->seq_delta.ResizeClear(0);
+  m_free.Push(record);
+}
+
+void cBGGenotypeManager::cGenotypeTable::resize(int capacity)
+{
+  tArray<cBGGenotype*> old_slots(m_slots);
+  m_slots.ResizeClear(capacity);
+  m_slots.SetAll(NULL);
+  m_count = 0;
+  for (int i = 0; i < old_slots.GetSize(); i++) if (old_slots[i]) Insert(old_slots[i]);
+}
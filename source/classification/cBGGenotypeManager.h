@@ -24,16 +24,17 @@
 
 #include "avida/Avida.h"
 
+#include "cBGGenotype.h"
 #include "cBioGroupManager.h"
 #include "cFlexVar.h"
 #include "tIterator.h"
 #include "tManagedPointerArray.h"
+#include "tSmartArray.h"
 #include "tSparseVectorList.h"
 
 namespace Avida {
   class Sequence;
 }
-class cBGGenotype;
 class cWorld;
 template <class T> class tDataCommandManager;
 
@@ -41,17 +42,72 @@ using namespace Avida;
 
 
 namespace nBGGenotypeManager {
-  const int HASH_SIZE = 3203;
+  const int INITIAL_TABLE_SIZE = 1024;          // must be a power of two
+  const int HISTORIC_BLOCK_SIZE = 1024;         // historic records allocated per arena block
+  const int HISTORIC_KEYFRAME_DEPTH = 16;       // historic genomes at multiples of this depth are stored in full
 }
 
 class cBGGenotypeManager : public cBioGroupManager
 {
 private:
+  // Open addressing (linear probing) table of genotypes, keyed either by genome hash or by genotype ID.  Capacity is
+  // kept a power of two at no more than half full, and removal shifts the rest of the probe cluster back so that no
+  // tombstones accumulate as genotypes come and go.
+  class cGenotypeTable
+  {
+  private:
+    tArray<cBGGenotype*> m_slots;
+    int m_count;
+    bool m_by_id;
+    
+    inline unsigned long long keyOf(const cBGGenotype* bg) const;
+    void resize(int capacity);
+    
+    cGenotypeTable(); // @not_implemented
+    cGenotypeTable(const cGenotypeTable&); // @not_implemented
+    cGenotypeTable& operator=(const cGenotypeTable&); // @not_implemented
+    
+  public:
+    cGenotypeTable(bool by_id)
+      : m_slots(nBGGenotypeManager::INITIAL_TABLE_SIZE, NULL), m_count(0), m_by_id(by_id) { ; }
+    
+    int GetSize() const { return m_count; }
+    int GetCapacity() const { return m_slots.GetSize(); }
+    
+    // Probe sequence access: start at FirstSlot(key) and step with NextSlot() until an empty (NULL) slot
+    int FirstSlot(unsigned long long key) const { return (int)(key & (unsigned long long)(m_slots.GetSize() - 1)); }
+    int NextSlot(int slot) const { return (slot + 1) & (m_slots.GetSize() - 1); }
+    cBGGenotype* GetSlot(int slot) const { return m_slots[slot]; }
+    
+    void Insert(cBGGenotype* bg);
+    bool Remove(cBGGenotype* bg);
+  };
+  
+  // Historic genotype records, allocated in fixed size blocks and recycled through a free list
+  class cHistoricArena
+  {
+  private:
+    tSmartArray<cBGGenotype::sHistoric*> m_blocks;
+    tSmartArray<cBGGenotype::sHistoric*> m_free;
+    
+    cHistoricArena(const cHistoricArena&); // @not_implemented
+    cHistoricArena& operator=(const cHistoricArena&); // @not_implemented
+    
+  public:
+    cHistoricArena() { m_free.SetReserve(nBGGenotypeManager::HISTORIC_BLOCK_SIZE); }
+    ~cHistoricArena();
+    
+    cBGGenotype::sHistoric* Alloc();
+    void Free(cBGGenotype::sHistoric* record);
+  };
+  
   cWorld* m_world;
 
-  tSparseVectorList<cBGGenotype> m_active_hash[nBGGenotypeManager::HASH_SIZE];
+  cGenotypeTable m_active_table;    // active genotypes, by genome hash
+  cGenotypeTable m_id_table;        // active and historic genotypes, by ID
   tManagedPointerArray<tSparseVectorList<cBGGenotype> > m_active_sz;
   tSparseVectorList<cBGGenotype> m_historic;
+  cHistoricArena m_historic_arena;  // packed state of the genotypes in m_historic
   cBGGenotype* m_coalescent;
   int m_best;
   int m_next_id;
@@ -82,13 +138,16 @@ public:
   // Genotype Manager Methods
   cBGGenotype* ClassifyNewBioUnit(cBioUnit* bu, tArray<cBioGroup*>* parents, tArrayMap<cString, cString>* hints = NULL);
   void AdjustGenotype(cBGGenotype* genotype, int old_size, int new_size);
+  void ReleaseHistoric(cBGGenotype::sHistoric* record) { m_historic_arena.Free(record); }
 
   const tArray<cString>& GetBioGroupPropertyList() const;
   bool BioGroupHasProperty(const cString& prop) const;
   cFlexVar GetBioGroupProperty(const cBGGenotype* genotype, const cString& prop) const;
   
 private:
-  unsigned int hashGenome(const Sequence& genome) const;
+  unsigned long long hashGenome(const Sequence& genome) const;
+  cBGGenotype* findActive(cBioUnit* bu, unsigned long long genome_hash) const;
+  void activateGenotype(cBGGenotype* genotype);
   cString nameGenotype(int size);
   
   void removeGenotype(cBGGenotype* genotype);
@@ -24,10 +24,12 @@
 #include "avida/core/Genome.h"
 
 #include "cAvidaContext.h"
-#include "cBioGroup.h"
+#include "cBGGenotype.h"
 #include "cHardwareManager.h"
 #include "cPhenotype.h"
+#include "cRandom.h"
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cWorld.h"
 #include "tAutoRelease.h"
 
@@ -36,20 +38,50 @@ using namespace Avida;
 
 cGenomeTestMetrics::cGenomeTestMetrics(cAvidaContext& ctx, cBioGroup* bg)
 {
-  tAutoRelease<cTestCPU> testcpu(ctx.GetWorld()->GetHardwareManager().CreateTestCPU(ctx));
-  
-  cCPUTestInfo test_info;
-  testcpu->TestGenome(ctx, test_info, Genome(bg->GetProperty("genome").AsString()));
+  // Genotypes hold their genome, sparing a parse of the "genome" property
+  cBGGenotype* genotype = dynamic_cast<cBGGenotype*>(bg);
+  if (genotype) test(ctx, genotype->GetGenome());
+  else test(ctx, Genome(bg->GetProperty("genome").AsString()));
+}
+
+
+void cGenomeTestMetrics::test(cAvidaContext& ctx, const Genome& genome)
+{
+  cTestResultCache* cache = ctx.GetWorld()->GetTestResultCache();
   
-  m_is_viable = test_info.IsViable();
+  cTestResultCache::sResult result;
+  if (!cache || !cache->Find(genome, result)) {
+    // With a cache, tests draw random numbers from their own generator, seeded by the genome, so that the run goes on
+    // the same whether or not a genome's result was found
+    cAvidaContext test_ctx(ctx);
+    cRandom rng(static_cast<int>(genome.GetSequence().GetHash() & 0x3FFFFFFF) + 1);
+    if (cache) test_ctx.SetRandom(rng);
+    
+    tAutoRelease<cTestCPU> testcpu(ctx.GetWorld()->GetHardwareManager().CreateTestCPU(test_ctx));
+    
+    cCPUTestInfo test_info;
+    testcpu->TestGenome(test_ctx, test_info, genome);
+    
+    result.is_viable = test_info.IsViable();
+    
+    cPhenotype& phenotype = test_info.GetTestPhenotype();
+    result.fitness = test_info.GetGenotypeFitness();
+    result.colony_fitness = test_info.GetColonyFitness();
+    result.merit = phenotype.GetMerit().GetDouble();
+    result.executed_size = phenotype.GetExecutedSize();
+    result.copied_size = phenotype.GetCopiedSize();
+    result.gestation_time = phenotype.GetGestationTime();
+    
+    if (cache) cache->Insert(genome, result);
+  }
   
-  cPhenotype& phenotype = test_info.GetTestPhenotype();
-  m_fitness = test_info.GetGenotypeFitness();
-  m_colony_fitness = test_info.GetColonyFitness();
-  m_merit = phenotype.GetMerit().GetDouble();
-  m_executed_size = phenotype.GetExecutedSize();
-  m_copied_size = phenotype.GetCopiedSize();
-  m_gestation_time = phenotype.GetGestationTime();  
+  m_is_viable = result.is_viable;
+  m_fitness = result.fitness;
+  m_colony_fitness = result.colony_fitness;
+  m_merit = result.merit;
+  m_executed_size = result.executed_size;
+  m_copied_size = result.copied_size;
+  m_gestation_time = result.gestation_time;
 }
 
 
@@ -24,6 +24,9 @@
 
 #include <cassert>
 
+namespace Avida {
+  class Genome;
+};
 class cAvidaContext;
 class cBioGroup;
 
@@ -44,6 +47,8 @@ private:
   
   cGenomeTestMetrics(cAvidaContext& ctx, cBioGroup* bg);
   
+  void test(cAvidaContext& ctx, const Avida::Genome& genome);
+  
 public:
   bool IsViable() const { return m_is_viable; }
   double GetFitness() const { return m_fitness; }
@@ -28,6 +28,8 @@
 
 #include "cInstSet.h"
 
+#include <cstring>
+
 using namespace AvidaTools;
 
 
@@ -35,14 +37,18 @@ const int MEMORY_INCREASE_MINIMUM = 5;
 const double MEMORY_INCREASE_FACTOR = 1.5;
 const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
+const unsigned long long HASH_BASE = 0x100000001B3ULL;
+const unsigned long long HASH_BASE_INVERSE = 0xCE965057AFF6957BULL; // HASH_BASE * HASH_BASE_INVERSE == 1 (mod 2^64)
+
 
 Avida::Sequence::Sequence(const Sequence& seq)
   : m_seq(seq.GetSize()), m_active_size(seq.GetSize()), m_mutation_steps(seq.GetMutationSteps())
+  , m_hash(seq.m_hash), m_hash_valid(seq.m_hash_valid), m_unmodified(0)
 {
   for (int i = 0; i < m_active_size; i++)  m_seq[i] = seq[i];
 }
 
-Avida::Sequence::Sequence(const cString & str)
+Avida::Sequence::Sequence(const cString & str) : m_hash(0), m_hash_valid(false), m_unmodified(0)
 {
   cString tmp_string(str);
   tmp_string.RemoveChar('_');  // Remove all blanks from alignments...
@@ -64,6 +70,7 @@ void Avida::Sequence::adjustCapacity(int new_size)
   
   // Make sure we're really changing the size...
   if (new_size == m_active_size) return;
+  siteModified((new_size < m_active_size) ? new_size : m_active_size);
   
   const int array_size = m_seq.GetSize();
   
@@ -88,6 +95,7 @@ void Avida::Sequence::prepareInsert(int pos, int num_sites)
   const int old_size = m_active_size;
   const int new_size = m_active_size + num_sites;
   adjustCapacity(new_size);
+  siteModified(pos);
   
   // Shift any sites needed...
   for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
@@ -98,6 +106,8 @@ void Avida::Sequence::Copy(int to, int from)
 {
   assert(to   >= 0   && to   < m_active_size);
   assert(from >= 0   && from < m_active_size);
+  hashSite(to, m_seq[to], m_seq[from]);
+  siteModified(to);
   m_seq[to] = m_seq[from];
 }
  
@@ -118,6 +128,7 @@ void Avida::Sequence::Resize(int new_size)
   
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  m_hash_valid = false;
   
   for (int i = old_size; i < new_size; i++) m_seq[i].SetOp(0);
 }
@@ -127,6 +138,7 @@ void Avida::Sequence::Insert(int pos, const cInstruction& inst)
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
   
+  hashInsert(pos, inst);
   prepareInsert(pos, 1);
   m_seq[pos] = inst;
 }
@@ -136,6 +148,7 @@ void Avida::Sequence::Insert(int pos, const Sequence& seq)
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
   
+  m_hash_valid = false;
   prepareInsert(pos, seq.GetSize());
   for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
 }
@@ -146,6 +159,10 @@ void Avida::Sequence::Remove(int pos, int num_sites)
   assert(pos >= 0);                         // Removal must be in sequence
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of sequence
   
+  if (num_sites == 1) hashRemove(pos);
+  else m_hash_valid = false;
+  siteModified(pos);
+  
   const int new_size = m_active_size - num_sites;
   for (int i = pos; i < new_size; i++) m_seq[i] = m_seq[i + num_sites];
   adjustCapacity(new_size);
@@ -158,6 +175,8 @@ void Avida::Sequence::Replace(int pos, int num_sites, const Sequence& seq)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
   const int size_change = seq.GetSize() - num_sites;
+  m_hash_valid = false;
+  siteModified(pos);
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
@@ -248,6 +267,9 @@ void Avida::Sequence::operator=(const Sequence& other_seq)
   for (int i = 0; i < m_active_size; i++) m_seq[i] = other_seq[i];
   
   m_mutation_steps = other_seq.m_mutation_steps;
+  m_hash = other_seq.m_hash;
+  m_hash_valid = other_seq.m_hash_valid;
+  m_unmodified = 0;
 }
 
 
@@ -256,6 +278,9 @@ bool Avida::Sequence::operator==(const Sequence& other_seq) const
   // Make sure the sizes are the same.
   if (m_active_size != other_seq.m_active_size) return false;
   
+  // Sequences with differing hashes cannot match, so skip the site comparison when both are already known
+  if (m_hash_valid && other_seq.m_hash_valid && m_hash != other_seq.m_hash) return false;
+  
   // Then go through line by line.
   for (int i = 0; i < m_active_size; i++)
     if (m_seq[i] != other_seq[i]) return false;
@@ -264,6 +289,79 @@ bool Avida::Sequence::operator==(const Sequence& other_seq) const
 }
 
 
+unsigned long long Avida::Sequence::GetHash() const
+{
+  if (!m_hash_valid) {
+    m_hash = hashRange(0, m_active_size);
+    m_hash_valid = true;
+  }
+  return m_hash;
+}
+
+
+bool Avida::Sequence::InheritHash(const Sequence& parent)
+{
+  if (parent.m_active_size != m_active_size) return false;
+  
+  unsigned long long hash = parent.GetHash();
+  for (int i = 0; i < m_active_size; i++) {
+    if (m_seq[i] != parent.m_seq[i]) hash += (unsigned long long)(m_seq[i].GetOp() - parent.m_seq[i].GetOp()) * hashPower(i);
+  }
+  
+  m_hash = hash;
+  m_hash_valid = true;
+  return true;
+}
+
+
+// Inserting at pos leaves the prefix [0, pos) in place and shifts every later site up one power of HASH_BASE.  Only
+// the shorter side of pos is summed, recovering the other side from the current hash.
+void Avida::Sequence::hashInsert(int pos, const cInstruction& inst)
+{
+  if (!m_hash_valid) return;
+  
+  unsigned long long prefix;
+  if (pos <= m_active_size - pos) prefix = hashRange(0, pos);
+  else prefix = m_hash - hashRange(pos, m_active_size);
+  
+  m_hash = prefix + (unsigned long long)(inst.GetOp() + 1) * hashPower(pos) + (m_hash - prefix) * HASH_BASE;
+}
+
+void Avida::Sequence::hashRemove(int pos)
+{
+  if (!m_hash_valid) return;
+  
+  unsigned long long prefix;
+  if (pos <= m_active_size - pos) prefix = hashRange(0, pos);
+  else prefix = m_hash - hashRange(pos, m_active_size);
+  
+  const unsigned long long suffix = m_hash - prefix - (unsigned long long)(m_seq[pos].GetOp() + 1) * hashPower(pos);
+  m_hash = prefix + suffix * HASH_BASE_INVERSE;
+}
+
+unsigned long long Avida::Sequence::hashRange(int begin, int end) const
+{
+  unsigned long long total = 0;
+  unsigned long long power = hashPower(begin);
+  for (int i = begin; i < end; i++) {
+    total += (unsigned long long)(m_seq[i].GetOp() + 1) * power;
+    power *= HASH_BASE;
+  }
+  return total;
+}
+
+unsigned long long Avida::Sequence::hashPower(int exp)
+{
+  unsigned long long result = 1;
+  unsigned long long base = HASH_BASE;
+  for (; exp; exp >>= 1) {
+    if (exp & 1) result *= base;
+    base *= base;
+  }
+  return result;
+}
+
+
 int Avida::Sequence::FindInst(const cInstruction& inst, int start_index) const
 {
   assert(start_index < m_active_size);  // Starting search after sequence end.
@@ -375,6 +473,127 @@ Avida::Sequence Avida::Sequence::Join(const Sequence& lhs, const Sequence& rhs)
 }
 
 
+// Number of differing sites between two equal length runs of instructions.  Instructions are single bytes, so the
+// runs are compared a word (eight sites) at a time, folding each differing byte down to one bit to be counted.
+static int countMismatches(const cInstruction* seq1, const cInstruction* seq2, int size)
+{
+  int mismatches = 0;
+  int i = 0;
+  if (sizeof(cInstruction) == 1) {
+    const unsigned char* bytes1 = reinterpret_cast<const unsigned char*>(seq1);
+    const unsigned char* bytes2 = reinterpret_cast<const unsigned char*>(seq2);
+    const unsigned long long LOW_BITS = 0x0101010101010101ULL;
+    for (; i + 8 <= size; i += 8) {
+      unsigned long long word1, word2;
+      memcpy(&word1, bytes1 + i, 8);
+      memcpy(&word2, bytes2 + i, 8);
+      unsigned long long diff = word1 ^ word2;
+      diff |= diff >> 4;
+      diff |= diff >> 2;
+      diff |= diff >> 1;
+      diff &= LOW_BITS;
+      mismatches += static_cast<int>((diff * LOW_BITS) >> 56);
+    }
+  }
+  for (; i < size; i++) if (seq1[i] != seq2[i]) mismatches++;
+  return mismatches;
+}
+
+
+// Sites per bit-vector block in the edit distance kernel
+const int EDIT_BLOCK_BITS = 64;
+
+// Patterns up to this many blocks keep their match vectors on the stack
+const int EDIT_STACK_BLOCKS = 8;
+
+
+// Myers/Hyyrö bit-vector Levenshtein distance between pattern (length m) and text (length n), both non-empty.  Each
+// column of the dynamic programming matrix is held as vertical +1/-1 delta bit-vectors in 64 site blocks, so a text
+// site costs one pass over ceil(m / 64) words instead of m cell updates.  When threshold >= 0, returns threshold + 1
+// as soon as the distance is known to exceed it.
+static int bitParallelEditDistance(const cInstruction* pattern, int m, const cInstruction* text, int n, int threshold)
+{
+  typedef unsigned long long tWord;
+  const tWord HIGH_BIT = 1ULL << (EDIT_BLOCK_BITS - 1);
+
+  const int num_blocks = (m + EDIT_BLOCK_BITS - 1) / EDIT_BLOCK_BITS;
+
+  tWord stack_peq[256 * EDIT_STACK_BLOCKS];
+  tWord stack_pv[EDIT_STACK_BLOCKS];
+  tWord stack_mv[EDIT_STACK_BLOCKS];
+  tArray<tWord> heap_buf;
+  tWord* peq = stack_peq;
+  tWord* pv = stack_pv;
+  tWord* mv = stack_mv;
+  if (num_blocks > EDIT_STACK_BLOCKS) {
+    heap_buf.Resize((256 + 2) * num_blocks);
+    peq = &heap_buf[0];
+    pv = peq + 256 * num_blocks;
+    mv = pv + num_blocks;
+  }
+
+  // Match vectors, only initialized for the symbols that occur in the pattern
+  bool present[256];
+  for (int i = 0; i < 256; i++) present[i] = false;
+  for (int i = 0; i < m; i++) {
+    const int op = pattern[i].GetOp();
+    if (!present[op]) {
+      present[op] = true;
+      for (int b = 0; b < num_blocks; b++) peq[op * num_blocks + b] = 0;
+    }
+    peq[op * num_blocks + i / EDIT_BLOCK_BITS] |= 1ULL << (i % EDIT_BLOCK_BITS);
+  }
+
+  for (int b = 0; b < num_blocks; b++) {
+    pv[b] = ~0ULL;
+    mv[b] = 0;
+  }
+  const tWord last_bit = 1ULL << ((m - 1) % EDIT_BLOCK_BITS);
+
+  int score = m;
+  for (int j = 0; j < n; j++) {
+    const int op = text[j].GetOp();
+    const tWord* eq_row = present[op] ? &peq[op * num_blocks] : NULL;
+
+    // The top boundary row increases by one with every text site
+    int hin = 1;
+    for (int b = 0; b < num_blocks; b++) {
+      tWord eq = eq_row ? eq_row[b] : 0;
+      const tWord p = pv[b];
+      const tWord mm = mv[b];
+      const tWord hin_neg = (hin < 0) ? 1ULL : 0ULL;
+
+      const tWord xv = eq | mm;
+      eq |= hin_neg;
+      const tWord xh = (((eq & p) + p) ^ p) | eq;
+      tWord ph = mm | ~(xh | p);
+      tWord mh = p & xh;
+
+      // Horizontal delta leaving the bottom of this block (or the last pattern site, for the final block)
+      const tWord out_bit = (b == num_blocks - 1) ? last_bit : HIGH_BIT;
+      int hout = 0;
+      if (ph & out_bit) hout = 1;
+      else if (mh & out_bit) hout = -1;
+
+      ph <<= 1;
+      mh <<= 1;
+      mh |= hin_neg;
+      if (hin > 0) ph |= 1ULL;
+      pv[b] = mh | ~(xv | ph);
+      mv[b] = ph & xv;
+
+      hin = hout;
+    }
+    score += hin;
+
+    // Each remaining text site can lower the final score by at most one
+    if (threshold >= 0 && score - (n - j - 1) > threshold) return threshold + 1;
+  }
+
+  return score;
+}
+
+
 int Avida::Sequence::FindOverlap(const Sequence& seq1, const Sequence& seq2, int offset)
 {
   assert(offset < seq1.GetSize());
@@ -396,10 +615,8 @@ int Avida::Sequence::FindHammingDistance(const Sequence& seq1, const Sequence& s
   
   int hamming_distance = seq1.GetSize() + seq2.GetSize() - 2 * overlap;
   
-  // Cycle through the overlap adding all differences to the distance.
-  for (int i = 0; i < overlap; i++) {
-    if (seq1[start1 + i] != seq2[start2 + i])  hamming_distance++;
-  }
+  // Add all differences within the overlap to the distance.
+  if (overlap > 0) hamming_distance += countMismatches(&seq1[start1], &seq2[start2], overlap);
   
   return hamming_distance;
 }
@@ -445,12 +662,15 @@ int Avida::Sequence::FindSlidingDistance(const Sequence& seq1, const Sequence& s
 }
 
 
-int Avida::Sequence::FindEditDistance(const Sequence& seq1, const Sequence& seq2)
+int Avida::Sequence::FindEditDistance(const Sequence& seq1, const Sequence& seq2, int threshold)
 {
   const int size1 = seq1.GetSize();
   const int size2 = seq2.GetSize();
   const int min_size = min(size1, size2);
   
+  // The length difference is a lower bound on the distance
+  if (threshold >= 0 && abs(size1 - size2) > threshold) return threshold + 1;
+  
   // If either size is zero, return the other one!
   if (!min_size) return max(size1, size2);
   
@@ -465,50 +685,9 @@ int Avida::Sequence::FindEditDistance(const Sequence& seq1, const Sequence& seq2
   
   if (test_size1 <= 0 || test_size2 <=0) return abs(test_size1 - test_size2);
   
-  // Now match everything else...
-  int* cur_row  = new int[test_size1];  // The row we are calculating
-  int* prev_row = new int[test_size1];  // The last row we calculated
-  
-  // Initialize the previous row to record the differece from nothing.
-  for (int i = 0; i < test_size1; i++)  prev_row[i] = i + 1;
-  
-  // Loop through each subsequent character in the test code
-  for (int i = 0; i < test_size2; i++) {
-    // Initialize the first entry in cur_row.
-    if (seq1[match_front] == seq2[match_front + i]) cur_row[0] = i;
-    else cur_row[0] = (i < prev_row[0]) ? (i+1) : (prev_row[0] + 1);
-    
-    // Move down the cur_row and fill it out.
-    for (int j = 1; j < test_size1; j++) {
-      // If the values are equal, keep the value in the upper left.
-      if (seq1[match_front + j] == seq2[match_front + i]) {
-        cur_row[j] = prev_row[j-1];
-      }
-      
-      // Otherwise, set the current position the the minimal of the three
-      // numbers above (insertion), to the left (deletion), or upper left
-      // (mutation) in the chart, plus one.
-      else {
-        cur_row[j] = (prev_row[j] < prev_row[j-1]) ? prev_row[j] : prev_row[j-1];
-        if (cur_row[j-1] < cur_row[j]) cur_row[j] = cur_row[j-1];
-        cur_row[j]++;
-      }
-    }
-    
-    // Swap cur_row and prev_row. (we only really need to move the cur row
-    // over to prev, but this saves us from having to keep re-allocating
-    // new rows.  We recycle!
-    int* temp_row = cur_row;
-    cur_row = prev_row;
-    prev_row = temp_row;
+  // Now match everything else, using the shorter core as the bit-vector pattern
+  if (test_size1 <= test_size2) {
+    return bitParallelEditDistance(&seq1[match_front], test_size1, &seq2[match_front], test_size2, threshold);
   }
-  
-  // Now that we are done, return the bottom-right corner of the chart.
-  
-  const int value = prev_row[test_size1 - 1];
-  
-  delete [] cur_row;
-  delete [] prev_row;
-  
-  return value;
+  return bitParallelEditDistance(&seq2[match_front], test_size2, &seq1[match_front], test_size1, threshold);
 }
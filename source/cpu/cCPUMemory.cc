@@ -47,6 +47,7 @@ void cCPUMemory::prepareInsert(int pos, int num_sites)
   const int old_size = m_active_size;
   const int new_size = m_active_size + num_sites;
   adjustCapacity(new_size);
+  siteModified(pos);
   
   // Shift any sites needed...
   for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
@@ -69,6 +70,7 @@ void cCPUMemory::Resize(int new_size)
 
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  m_hash_valid = false;
   
   for (int i = old_size; i < new_size; i++) {
     m_seq[i].SetOp(0);
@@ -83,6 +85,7 @@ void cCPUMemory::ResizeOld(int new_size)
 
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  m_hash_valid = false;
 
   for (int i = old_size; i < new_size; i++) m_flag_array[i] = 0;
 }
@@ -95,6 +98,8 @@ void cCPUMemory::Copy(int to, int from)
   assert(from >= 0);
   assert(from < m_seq.GetSize());
   
+  hashSite(to, m_seq[to], m_seq[from]);
+  siteModified(to);
   m_seq[to] = m_seq[from];
   m_flag_array[to] = m_flag_array[from];
 }
@@ -105,6 +110,7 @@ void cCPUMemory::Insert(int pos, const cInstruction& inst)
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
 
+  hashInsert(pos, inst);
   prepareInsert(pos, 1);
   m_seq[pos] = inst;
   m_flag_array[pos] = 0;
@@ -115,6 +121,7 @@ void cCPUMemory::Insert(int pos, const Sequence& genome)
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
 
+  m_hash_valid = false;
   prepareInsert(pos, genome.GetSize());
   for (int i = 0; i < genome.GetSize(); i++) {
     m_seq[i + pos] = genome[i];
@@ -128,6 +135,10 @@ void cCPUMemory::Remove(int pos, int num_sites)
   assert(pos >= 0);                         // Removal must be in genome.
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of genome.
 
+  if (num_sites == 1) hashRemove(pos);
+  else m_hash_valid = false;
+  siteModified(pos);
+
   const int new_size = m_active_size - num_sites;
   for (int i = pos; i < new_size; i++) {
     m_seq[i] = m_seq[i + num_sites];
@@ -143,6 +154,8 @@ void cCPUMemory::Replace(int pos, int num_sites, const Sequence& genome)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
   const int size_change = genome.GetSize() - num_sites;
+  m_hash_valid = false;
+  siteModified(pos);
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
@@ -165,6 +178,9 @@ void cCPUMemory::operator=(const cCPUMemory& other_memory)
     m_seq[i] = other_memory.m_seq[i];
     m_flag_array[i] = other_memory.m_flag_array[i];
   }
+  m_hash = other_memory.m_hash;
+  m_hash_valid = other_memory.m_hash_valid;
+  m_unmodified = 0;
 }
 
 
@@ -177,5 +193,8 @@ void cCPUMemory::operator=(const Sequence& other_genome)
     m_seq[i] = other_genome[i];
     m_flag_array[i] = 0;
   }
+  m_hash_valid = other_genome.HasValidHash();
+  if (m_hash_valid) m_hash = other_genome.GetHash();
+  m_unmodified = 0;
 }
 
@@ -88,6 +88,8 @@ public:
 			m_flag_array[i] = 0;
 		}
     m_mutation_steps.Clear();
+    m_hash_valid = false;
+    m_unmodified = 0;
 	}
   inline void ClearFlags() { m_flag_array.SetAll(0); }
   void Reset(int new_size);     // Reset size, clearing contents...
@@ -56,6 +56,7 @@ cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* in
 , m_has_post_costs(inst_set->HasPostCosts())
 {
 	m_task_switching_cost=0;
+  m_energy_enabled = (world->GetConfig().ENERGY_ENABLED.Get() > 0);
 	int switch_cost =  world->GetConfig().TASK_SWITCH_PENALTY.Get();
 	m_has_any_costs = (m_has_costs | m_has_ft_costs | m_has_energy_costs | m_has_res_costs | m_has_fem_res_costs | switch_cost | m_has_female_costs | 
                      m_has_choosy_female_costs | m_has_post_costs);
@@ -69,6 +70,21 @@ cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* in
 }
 
 
+void cHardwareBase::recycleBase(cOrganism* in_organism)
+{
+  // Restore the state set up by the constructor; the costs depend only on the instruction set, which is unchanged
+  m_organism = in_organism;
+  m_tracer = NULL;
+  m_minitracer = NULL;
+  m_microtrace = false;
+  m_topnavtrace = false;
+  m_reprotrace = false;
+  m_ext_mem.Resize(0);
+  
+  assert(m_organism != NULL);
+}
+
+
 void cHardwareBase::Reset(cAvidaContext& ctx)
 {
   m_organism->HardwareReset(ctx);
@@ -230,8 +246,8 @@ bool cHardwareBase::Divide_CheckViable(cAvidaContext& ctx, const int parent_size
     const int merit_base = phenotype.CalcSizeMerit();
     const double cur_fitness = merit_base * phenotype.GetCurBonus() / phenotype.GetTimeUsed();
     const double fitness_ratio = cur_fitness / phenotype.GetLastFitness();
-    const tArray<int>& childtasks = phenotype.GetCurTaskCount();
-    const tArray<int>& parenttasks = phenotype.GetLastTaskCount();
+    const tArraySlice<int>& childtasks = phenotype.GetCurTaskCount();
+    const tArraySlice<int>& parenttasks = phenotype.GetLastTaskCount();
     
     bool sterilize = false;
     
@@ -285,6 +301,11 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
   
   int totalMutations = 0;
   Sequence& offspring_genome = m_organism->OffspringGenome().GetSequence();
+  const Sequence& offspring_sites = offspring_genome; // read only access, which leaves the genome hash intact
+  
+  // Carry the parent's genome hash over to the offspring, so that the mutations below update it site by site and
+  // classification does not need to rehash the whole genome
+  offspring_genome.InheritHash(m_organism->GetGenome().GetSequence());
   
   m_organism->GetPhenotype().SetDivType(mut_multiplier);
   
@@ -347,9 +368,9 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
   // Divide Mutations
   if (m_organism->TestDivideMut(ctx) && totalMutations < maxmut) {
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-    char before_mutation = offspring_genome[mut_line].GetSymbol();
-    offspring_genome[mut_line] = m_inst_set->GetRandomInst(ctx);
-    offspring_genome.GetMutationSteps().AddSubstitutionMutation(mut_line, before_mutation, offspring_genome[mut_line].GetSymbol());
+    char before_mutation = offspring_sites[mut_line].GetSymbol();
+    offspring_genome.SetInst(mut_line, m_inst_set->GetRandomInst(ctx));
+    offspring_genome.GetMutationSteps().AddSubstitutionMutation(mut_line, before_mutation, offspring_sites[mut_line].GetSymbol());
     totalMutations++;
   }
   
@@ -360,9 +381,9 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
   {
     if (totalMutations >= maxmut) break;
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-    char before_mutation = offspring_genome[mut_line].GetSymbol();
-    offspring_genome[mut_line] = m_inst_set->GetRandomInst(ctx);
-    offspring_genome.GetMutationSteps().AddSubstitutionMutation(mut_line, before_mutation, offspring_genome[mut_line].GetSymbol());
+    char before_mutation = offspring_sites[mut_line].GetSymbol();
+    offspring_genome.SetInst(mut_line, m_inst_set->GetRandomInst(ctx));
+    offspring_genome.GetMutationSteps().AddSubstitutionMutation(mut_line, before_mutation, offspring_sites[mut_line].GetSymbol());
     totalMutations++;
   }
   
@@ -371,7 +392,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
   if (m_organism->TestDivideIns(ctx) && offspring_genome.GetSize() < max_genome_size && totalMutations < maxmut) {
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize() + 1);
     offspring_genome.Insert(mut_line, m_inst_set->GetRandomInst(ctx));
-    offspring_genome.GetMutationSteps().AddInsertionMutation(mut_line, offspring_genome[mut_line].GetSymbol());
+    offspring_genome.GetMutationSteps().AddInsertionMutation(mut_line, offspring_sites[mut_line].GetSymbol());
     totalMutations++;
   }
   
@@ -384,7 +405,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
     if (totalMutations >= maxmut) break;
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize() + 1);
     offspring_genome.Insert(mut_line, m_inst_set->GetRandomInst(ctx));
-    offspring_genome.GetMutationSteps().AddInsertionMutation(mut_line, offspring_genome[mut_line].GetSymbol());
+    offspring_genome.GetMutationSteps().AddInsertionMutation(mut_line, offspring_sites[mut_line].GetSymbol());
     totalMutations++;
   }
   
@@ -392,7 +413,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
   // Divide Deletions
   if (m_organism->TestDivideDel(ctx) && offspring_genome.GetSize() > min_genome_size && totalMutations < maxmut) {
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-    offspring_genome.GetMutationSteps().AddDeletionMutation(mut_line, offspring_genome[mut_line].GetSymbol());
+    offspring_genome.GetMutationSteps().AddDeletionMutation(mut_line, offspring_sites[mut_line].GetSymbol());
     offspring_genome.Remove(mut_line);
     totalMutations++;
   }
@@ -405,7 +426,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
     if (offspring_genome.GetSize() <= min_genome_size) break;
     if (totalMutations >= maxmut) break;
     const unsigned int mut_line = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-    offspring_genome.GetMutationSteps().AddDeletionMutation(mut_line, offspring_genome[mut_line].GetSymbol());
+    offspring_genome.GetMutationSteps().AddDeletionMutation(mut_line, offspring_sites[mut_line].GetSymbol());
     offspring_genome.Remove(mut_line);
     totalMutations++;
   }
@@ -425,9 +446,9 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
     if (num_mut > 0 && totalMutations < maxmut) {
       for (int i = 0; i < num_mut && totalMutations < maxmut; i++) {
         int site = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-        char before_mutation = offspring_genome[site].GetSymbol();
-        offspring_genome[site] = m_inst_set->GetRandomInst(ctx);
-        offspring_genome.GetMutationSteps().AddSubstitutionMutation(site, before_mutation, offspring_genome[site].GetSymbol());
+        char before_mutation = offspring_sites[site].GetSymbol();
+        offspring_genome.SetInst(site, m_inst_set->GetRandomInst(ctx));
+        offspring_genome.GetMutationSteps().AddSubstitutionMutation(site, before_mutation, offspring_sites[site].GetSymbol());
         totalMutations++;
       }
     }
@@ -452,7 +473,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
       // Actually do the mutations (in reverse sort order)
       for (int i = mut_sites.GetSize() - 1; i >= 0; i--) {
         offspring_genome.Insert(mut_sites[i], m_inst_set->GetRandomInst(ctx));
-        offspring_genome.GetMutationSteps().AddInsertionMutation(mut_sites[i], offspring_genome[mut_sites[i]].GetSymbol());
+        offspring_genome.GetMutationSteps().AddInsertionMutation(mut_sites[i], offspring_sites[mut_sites[i]].GetSymbol());
       }
       
       totalMutations += num_mut;
@@ -472,7 +493,7 @@ int cHardwareBase::Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier,
     // If we have lines to delete...
     for (int i = 0; i < num_mut; i++) {
       int site = ctx.GetRandom().GetUInt(offspring_genome.GetSize());
-      offspring_genome.GetMutationSteps().AddDeletionMutation(site, offspring_genome[site].GetSymbol());
+      offspring_genome.GetMutationSteps().AddDeletionMutation(site, offspring_sites[site].GetSymbol());
       offspring_genome.Remove(site);
     }
     
@@ -871,7 +892,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   if (phenotype.CopyTrue() == true) return false;
 	
   const double parent_fitness = m_organism->GetTestFitness(ctx);
-  const tArray<int>& parenttasks = phenotype.GetCurTaskCount();
+  const tArraySlice<int>& parenttasks = phenotype.GetCurTaskCount();
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
@@ -914,7 +935,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
     RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-    const tArray<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+    const tArraySlice<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
     bool del = false;
     bool added = false;
     for (int i=0; i<childtasks.GetSize(); i++)
@@ -939,7 +960,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const tArray<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const tArraySlice<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -983,7 +1004,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   if (phenotype.CopyTrue() == true) return false;
 	
   const double parent_fitness = m_organism->GetTestFitness(ctx);
-  const tArray<int>& parenttasks = phenotype.GetCurTaskCount();
+  const tArraySlice<int>& parenttasks = phenotype.GetCurTaskCount();
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
@@ -1028,7 +1049,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
 	  RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-	  const tArray<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+	  const tArraySlice<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
 	  bool del = false;
 	  bool added = false;
 	  for (int i=0; i<childtasks.GetSize(); i++)
@@ -1053,7 +1074,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const tArray<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const tArraySlice<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -1285,7 +1306,7 @@ bool cHardwareBase::Inst_DefaultEnergyUsage(cAvidaContext& ctx)
 // should proceed.
 bool cHardwareBase::SingleProcess_PayPreCosts(cAvidaContext& ctx, const cInstruction& cur_inst, const int thread_id)
 { 
-  if (m_world->GetConfig().ENERGY_ENABLED.Get() > 0) {
+  if (m_energy_enabled) {
     // TODO:  Get rid of magic number. check avaliable energy first
     double energy_req = m_inst_energy_cost[cur_inst.GetOp()] * (m_organism->GetPhenotype().GetMerit().GetDouble() / 100.0); //compensate by factor of 100
     
@@ -1390,7 +1411,7 @@ bool cHardwareBase::SingleProcess_PayPreCosts(cAvidaContext& ctx, const cInstruc
     if (m_active_thread_costs[thread_id] == 1) m_active_thread_costs[thread_id] = 0;
   }
   
-  if (m_world->GetConfig().ENERGY_ENABLED.Get() > 0) {
+  if (m_energy_enabled) {
     m_inst_energy_cost[cur_inst.GetOp()] = m_inst_set->GetEnergyCost(cur_inst); // reset instruction energy cost
   }
   return true;
@@ -93,6 +93,7 @@ protected:
   bool m_has_female_costs;
   bool m_has_choosy_female_costs;
   bool m_has_post_costs;
+  bool m_energy_enabled;
 
   // --------  Base Hardware Feature Support  ---------
   tSmartArray<int> m_ext_mem;
@@ -114,6 +115,8 @@ protected:
   cHardwareBase(const cHardwareBase&); // @not_implemented
   cHardwareBase& operator=(const cHardwareBase&); // @not_implemented
 
+  void recycleBase(cOrganism* in_organism);
+
 private: 
   cString null_str;
 
@@ -131,6 +134,11 @@ public:
 
   // --------  Core Functionality  --------
   void Reset(cAvidaContext& ctx);
+  
+  // Hardware released by a dead organism may be reset in place for a newly created one (see cHardwareManager)
+  virtual bool SupportsRecycling() const { return false; }
+  virtual void Recycle(cAvidaContext& ctx, cOrganism* in_organism) { (void)ctx, (void)in_organism; assert(false); }
+  
   virtual bool SingleProcess(cAvidaContext& ctx, bool speculative = false) = 0;
   virtual void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst) = 0;
 
@@ -761,6 +761,7 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
 
 cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_organism, cInstSet* in_inst_set)
 : cHardwareBase(world, in_organism, in_inst_set)
+, m_label_index(m_memory, in_inst_set)
 , m_last_cell_data(false, 0)
 {
   m_functions = s_inst_slib->GetFunctions();
@@ -770,17 +771,38 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   
   m_thread_slicing_parallel = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1);
   m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
+  m_task_switch_penalty = m_world->GetConfig().TASK_SWITCH_PENALTY_TYPE.Get();
   
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
+  m_no_active_promoter_halt = (m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2);
   
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
+  m_exec_features = 0;
+  if (m_promoters_enabled || m_constitutive_regulation) m_exec_features |= EXEC_PROMOTERS;
+  if (m_has_any_costs) m_exec_features |= EXEC_COSTS;
+  if (m_thread_slicing_parallel) m_exec_features |= EXEC_THREAD_SLICING;
+  
   m_memory = in_organism->GetGenome().GetSequence();  // Initialize memory...
   Reset(ctx);                            // Setup the rest of the hardware...
   internalReset();
 }
 
+void cHardwareCPU::Recycle(cAvidaContext& ctx, cOrganism* in_organism)
+{
+  // Repeat the construction sequence above, keeping the configuration flags (fixed for the world and instruction set)
+  recycleBase(in_organism);
+  m_last_cell_data = std::make_pair(false, 0);
+  
+  m_spec_die = false;
+  m_epigenetic_state = false;
+  
+  m_memory = in_organism->GetGenome().GetSequence();
+  Reset(ctx);
+  internalReset();
+}
+
 bool cHardwareCPU::checkNoMutList(cHeadCPU to)
 {
     //Anya's code for head to head experiments
@@ -888,9 +910,32 @@ void cHardwareCPU::cLocalThread::Reset(cHardwareBase* in_hardware, int in_id)
 
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
+//
+// The execution loop is specialized on the features in m_exec_features, so that the common case (no promoters,
+// costs, thread slicing or tracing) compiles down to a loop without any of their checks.
 
 bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
 {
+  const int features = m_exec_features | ((m_tracer != NULL) ? EXEC_TRACE : 0);
+  
+  switch (features) {
+    case 0:                                         return singleProcess<0>(ctx, speculative);
+    case EXEC_PROMOTERS:                            return singleProcess<EXEC_PROMOTERS>(ctx, speculative);
+    case EXEC_COSTS:                                return singleProcess<EXEC_COSTS>(ctx, speculative);
+    case EXEC_PROMOTERS | EXEC_COSTS:               return singleProcess<EXEC_PROMOTERS | EXEC_COSTS>(ctx, speculative);
+    case EXEC_THREAD_SLICING:                       return singleProcess<EXEC_THREAD_SLICING>(ctx, speculative);
+    case EXEC_THREAD_SLICING | EXEC_COSTS:          return singleProcess<EXEC_THREAD_SLICING | EXEC_COSTS>(ctx, speculative);
+    default:                                        return singleProcess<EXEC_ALL>(ctx, speculative);
+  }
+}
+
+template<int FEATURES> bool cHardwareCPU::singleProcess(cAvidaContext& ctx, bool speculative)
+{
+  const bool promoters = (FEATURES & EXEC_PROMOTERS);
+  const bool costs = (FEATURES & EXEC_COSTS);
+  const bool thread_slicing = (FEATURES & EXEC_THREAD_SLICING);
+  const bool trace = (FEATURES & EXEC_TRACE);
+  
   assert(!speculative || (speculative && !m_thread_slicing_parallel));
   
   int last_IP_pos = getIP().GetPosition();
@@ -907,17 +952,17 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
+  if (promoters && phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
   
   // Count the cpu cycles used
   phenotype.IncCPUCyclesUsed();
-  if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
+  if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
   
   int num_threads = m_threads.GetSize();
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  int num_inst_exec = m_thread_slicing_parallel ? num_threads : 1;
+  int num_inst_exec = (thread_slicing && m_thread_slicing_parallel) ? num_threads : 1;
   
   //  bool isInterruptEnabled(false);
   //  if (m_world->GetConfig().ACTIVE_MESSAGES_ENABLED.Get() == 1)
@@ -943,12 +988,13 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
 #endif
     
     // Print the status of this CPU at each step...
-    if (m_tracer != NULL) m_tracer->TraceHardware(ctx, *this);
+    if (trace && m_tracer != NULL) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const cInstruction& cur_inst = ip.GetInst();
+    const cInstSet::sDecodedInst& cur_decoded = m_inst_set->GetDecodedInst(cur_inst);
     
-    if (speculative && (m_spec_die || m_inst_set->ShouldStall(cur_inst))) {
+    if (speculative && (m_spec_die || (cur_decoded.flags & nInstFlag::STALL))) {
       // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
       phenotype.DecCPUCyclesUsed();
@@ -959,25 +1005,24 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    if (costs && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     
     // Constitutive regulation applied here
-    if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+    if (promoters && m_constitutive_regulation) Inst_SenseRegulate(ctx); 
     
     // If there are no active promoters and a certain mode is set, then don't execute any further instructions
-    if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    if (promoters && m_promoters_enabled && m_no_active_promoter_halt && m_promoter_index == -1) exec = false;
     
     // Now execute the instruction...
     if (exec == true) {
       // NOTE: This call based on the cur_inst must occur prior to instruction
       //       execution, because this instruction reference may be invalid after
       //       certain classes of instructions (namely divide instructions) @DMB
-      const int time_cost = m_inst_set->GetAddlTimeCost(cur_inst);
+      const int time_cost = cur_decoded.addl_time_cost;
       
       // Prob of exec (moved from SingleProcess_PayCosts so that we advance IP after a fail)
-      if (m_inst_set->GetProbFail(cur_inst) > 0.0) {
-        exec = !( ctx.GetRandom().P(m_inst_set->GetProbFail(cur_inst)) );
-      }
+      const double prob_fail = m_inst_set->GetProbFail(cur_inst);
+      if (prob_fail > 0.0) exec = !ctx.GetRandom().P(prob_fail);
       
       // Flag instruction as executed even if it failed (moved from SingleProcess_ExecuteInst)
       // this allows division conditions to be met even if most instruction executions failed. @JEB
@@ -986,10 +1031,10 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       getIP().SetFlagExecuted();
       
       // Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (promoters && m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
-        if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
+        if (SingleProcess_ExecuteInst(ctx, cur_inst, cur_decoded.lib_fun_id) && costs) { 
           SingleProcess_PayPostResCosts(ctx, cur_inst); 
           SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
         }
@@ -1006,7 +1051,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (promoters && m_promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) Inst_Terminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() && (m_threads[m_cur_thread].GetPromoterInstExecuted() >= m_world->GetConfig().PROMOTER_INST_MAX.Get())) 
@@ -1049,19 +1094,19 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
 
 // This method will handle the actual execution of an instruction
 // within a single process, once that function has been finalized.
-bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
+bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst, int inst_idx) 
 {
   // Copy Instruction locally to handle stochastic effects
   cInstruction actual_inst = cur_inst;
   
 #ifdef EXECUTION_ERRORS
   // If there is an execution error, execute a random instruction.
-  if (m_organism->TestExeErr()) actual_inst = m_inst_set->GetRandomInst(ctx);
+  if (m_organism->TestExeErr()) {
+    actual_inst = m_inst_set->GetRandomInst(ctx);
+    inst_idx = m_inst_set->GetLibFunctionIndex(actual_inst);
+  }
 #endif /* EXECUTION_ERRORS */
   
-  // Get a pointer to the corresponding method...
-  int inst_idx = m_inst_set->GetLibFunctionIndex(actual_inst);
-  
   // instruction execution count incremented
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
 	
@@ -1071,7 +1116,7 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruct
   // NOTE: Organism may be dead now if instruction executed killed it (such as some divides, "die", or "kazi")
   
   // Add in a cycle cost for switching which task is performed
-  if (m_world->GetConfig().TASK_SWITCH_PENALTY_TYPE.Get()) {
+  if (m_task_switch_penalty) {
     if (m_organism->GetPhenotype().GetNumNewUniqueReactions()) {
       int cost = m_organism->GetPhenotype().GetNumNewUniqueReactions() * m_world->GetConfig().TASK_SWITCH_PENALTY.Get();
       IncrementTaskSwitchingCost(cost);
@@ -1097,7 +1142,7 @@ void cHardwareCPU::ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst
   
   if (m_tracer != NULL) m_tracer->TraceHardware(ctx, *this, true);
   
-  SingleProcess_ExecuteInst(ctx, inst);
+  SingleProcess_ExecuteInst(ctx, inst, m_inst_set->GetLibFunctionIndex(inst));
   
   m_organism->SetRunning(prev_run_state);
 }
@@ -1186,17 +1231,17 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
   // Call special functions depending on if jump is forwards or backwards.
   int found_pos = 0;
   if ( direction < 0 ) {
-    found_pos = FindLabel_Backward(search_label, m_memory, inst_ptr.GetPosition() - search_label.GetSize());
+    found_pos = m_label_index.FindBackward(search_label, inst_ptr.GetPosition() - search_label.GetSize());
   }
   
   // Jump forward.
   else if (direction > 0) {
-    found_pos = FindLabel_Forward(search_label, m_memory, inst_ptr.GetPosition());
+    found_pos = m_label_index.FindForward(search_label, inst_ptr.GetPosition());
   }
   
   // Jump forward from the very beginning.
   else {
-    found_pos = FindLabel_Forward(search_label, m_memory, 0);
+    found_pos = m_label_index.FindForward(search_label, 0);
   }
   
   // Return the last line of the found label, if it was found.
@@ -1207,197 +1252,18 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
 }
 
 
-// Search forwards for search_label from _after_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Forward(const cCodeLabel & search_label,
-                                    const Sequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize() && pos >= 0);
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos += label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-    
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-             m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-        start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-             m_inst_set->IsNop( search_genome[end_pos] )) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        // pos = end_pos;
-        pos = label_size + offset;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
-// Search backwards for search_label from _before_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Backward(const cCodeLabel & search_label,
-                                     const Sequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize());
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos -= label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-        start_pos--;
-      }
-      while (end_pos < search_start &&
-             m_inst_set->IsNop(search_genome[end_pos])) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod(search_genome[offset + matches])) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        pos = end_pos;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
 // Search for 'in_label' anywhere in the hardware.
 cHeadCPU cHardwareCPU::FindLabel(const cCodeLabel & in_label, int direction)
 {
   assert (in_label.GetSize() > 0);
   
-  // IDEALY:
-  // Keep making jumps (in the proper direction) equal to the label
-  // length.  If we are inside of a label, check its size, and see if
-  // any of the sub-labels match properly.
-  // FOR NOW:
-  // Get something which works, no matter how inefficient!!!
-  
+  // Searching starts from the beginning of memory, so a backward search can only find the label right there
   cHeadCPU temp_head(this);
-  
-  while (temp_head.InMemory()) {
-    // IDEALY: Analyze the label we are in; see if the one we are looking
-    // for could be a sub-label of it.  Skip past it if not.
-    
-    int i;
-    for (i = 0; i < in_label.GetSize(); i++) {
-      if (!m_inst_set->IsNop(temp_head.GetInst()) ||
-          in_label[i] != m_inst_set->GetNopMod(temp_head.GetInst())) {
-        break;
-      }
-    }
-    if (i == GetLabel().GetSize()) {
-      temp_head.AbsJump(i - 1);
-      return temp_head;
-    }
-    
-    temp_head.AbsJump(direction);     // IDEALY: MAKE LARGER JUMPS
+  int found_pos = m_label_index.FindSequence(in_label, 0);
+  if (direction <= 0 && found_pos != 0) found_pos = -1;
+  if (found_pos >= 0) {
+    temp_head.AbsJump(found_pos + in_label.GetSize() - 1);
+    return temp_head;
   }
   
   temp_head.AbsSet(-1);
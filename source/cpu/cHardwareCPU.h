@@ -30,6 +30,7 @@
 #include "cCPUMemory.h"
 #include "cCPUStack.h"
 #include "cHardwareBase.h"
+#include "cLabelIndex.h"
 #include "cString.h"
 #include "cStats.h"
 #include "tArray.h"
@@ -103,10 +104,21 @@ protected:
   static tInstLib<tMethod>* initInstLib(void);
 
 
+  // Execution features that select a specialization of singleProcess()
+  enum {
+    EXEC_PROMOTERS = 0x1,       // promoters or constitutive regulation are enabled
+    EXEC_COSTS = 0x2,           // instructions may carry pre or post execution costs
+    EXEC_THREAD_SLICING = 0x4,  // every thread executes an instruction each cycle
+    EXEC_TRACE = 0x8,           // a tracer is attached (checked on every call)
+    EXEC_ALL = 0xF
+  };
+
+
   // --------  Member Variables  --------
   const tMethod* m_functions;
 
   cCPUMemory m_memory;          // Memory...
+  cLabelIndex m_label_index;    // Nop runs in memory, for label searches
   cCPUStack m_global_stack;     // A stack that all threads share.
 
   tArray<cLocalThread> m_threads;
@@ -122,11 +134,15 @@ protected:
 
     bool m_thread_slicing_parallel:1;
     bool m_no_cpu_cycle_time:1;
+    bool m_task_switch_penalty:1;
 
     bool m_promoters_enabled:1;
     bool m_constitutive_regulation:1;
+    bool m_no_active_promoter_halt:1;
 
     bool m_slip_read_head:1;
+
+    unsigned int m_exec_features:4;
   };
 
   // <-- Promoter model
@@ -154,7 +170,8 @@ protected:
   // Epigenetic State -->
 
 
-  bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
+  template<int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
+  bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst, int inst_idx);
 
   // --------  Stack Manipulation...  --------
   inline void StackPush(int value);
@@ -174,8 +191,6 @@ protected:
   cCodeLabel& GetLabel() { return m_threads[m_cur_thread].next_label; }
   void ReadLabel(int max_size=nHardware::MAX_LABEL_SIZE);
   cHeadCPU FindLabel(int direction);
-  int FindLabel_Forward(const cCodeLabel & search_label, const Sequence& search_genome, int pos);
-  int FindLabel_Backward(const cCodeLabel & search_label, const Sequence& search_genome, int pos);
   cHeadCPU FindLabel(const cCodeLabel & in_label, int direction);
   const cCodeLabel& GetReadLabel() const { return m_threads[m_cur_thread].read_label; }
   cCodeLabel& GetReadLabel() { return m_threads[m_cur_thread].read_label; }
@@ -240,6 +255,9 @@ public:
   static tInstLib<tMethod>* GetInstLib() { return s_inst_slib; }
   static cString GetDefaultInstFilename() { return "instset-heads.cfg"; }
 
+  bool SupportsRecycling() const { return true; }
+  void Recycle(cAvidaContext& ctx, cOrganism* in_organism);
+
   bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
 
@@ -427,7 +427,7 @@ tInstLib<cHardwareExperimental::tMethod>* cHardwareExperimental::initInstLib(voi
 }
 
 cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world, cOrganism* in_organism, cInstSet* in_inst_set)
-: cHardwareBase(world, in_organism, in_inst_set), m_sensor(world, in_organism)
+: cHardwareBase(world, in_organism, in_inst_set), m_label_index(m_memory, in_inst_set), m_sensor(world, in_organism)
 {
   m_functions = s_inst_slib->GetFunctions();
   
@@ -449,6 +449,19 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
   Reset(ctx);                                         // Setup the rest of the hardware...
 }
 
+void cHardwareExperimental::Recycle(cAvidaContext& ctx, cOrganism* in_organism)
+{
+  // Repeat the construction sequence above, keeping the configuration flags (fixed for the world and instruction set)
+  recycleBase(in_organism);
+  m_sensor = cOrgSensor(m_world, in_organism);
+  m_last_cell_data = std::make_pair(false, 0);
+  
+  m_spec_die = false;
+  
+  m_memory = in_organism->GetGenome().GetSequence();
+  Reset(ctx);
+}
+
 
 void cHardwareExperimental::internalReset()
 {
@@ -575,7 +588,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  const int num_inst_exec = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1) ? m_threads.GetSize() : 1;
+  const int num_inst_exec = m_thread_slicing_parallel ? m_threads.GetSize() : 1;
   
   int num_active = 0;
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -952,38 +965,33 @@ cHeadCPU cHardwareExperimental::FindLabelStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = 0;
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsLabel(memory[pos])) { // starting label found
+  while ((pos = m_label_index.NextLabelInst(pos, memory.GetSize())) < memory.GetSize()) { // starting label found
+    pos++;
+    
+    // Check for direct matched label pattern, can be substring of 'label'ed target
+    // - must match all NOPs in search_label
+    // - extra NOPs in 'label'ed target are ignored
+    int size_matched = 0;
+    while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
+      if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
+      size_matched++;
       pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          size_matched++; // Increment size matched so that it includes the label instruction
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        return cHeadCPU(this, pos - 1, ip.GetMemSpace());
+    }
+    
+    // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
+    if (size_matched == search_label.GetSize()) {
+      // Return Head pointed at last NOP of label sequence
+      if (mark_executed) {
+        size_matched++; // Increment size matched so that it includes the label instruction
+        const int start = pos - size_matched;
+        const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+        for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
       }
-      
-      continue; 
+      return cHeadCPU(this, pos - 1, ip.GetMemSpace());
     }
-    pos++;
   }
   
   // Return start point if not found
@@ -998,32 +1006,30 @@ cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = 0;
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsNop(memory[pos])) { // start of sequence found
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        return cHeadCPU(this, pos - 1, ip.GetMemSpace());
+  while ((pos = m_label_index.NextNop(pos, memory.GetSize())) < memory.GetSize()) { // start of sequence found
+    
+    // Check for direct matched label pattern, can be substring of 'label'ed target
+    // - must match all NOPs in search_label
+    // - extra NOPs in 'label'ed target are ignored
+    int size_matched = 0;
+    while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
+      if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
+      size_matched++;
+      pos++;
+    }
+    
+    // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
+    if (size_matched == search_label.GetSize()) {
+      // Return Head pointed at last NOP of label sequence
+      if (mark_executed) {
+        const int start = pos - size_matched;
+        const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+        for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
       }
+      return cHeadCPU(this, pos - 1, ip.GetMemSpace());
     }
     pos++;
   }
@@ -1045,38 +1051,37 @@ cHeadCPU cHardwareExperimental::FindLabelForward(bool mark_executed)
   pos++;
   
   while (pos.GetPosition() != ip.GetPosition()) {
-    if (m_inst_set->IsLabel(pos.GetInst())) { // starting label found
-      const int label_start = pos.GetPosition();
+    pos.Set(m_label_index.NextLabelInst(pos.GetPosition(), ip.GetPosition()), ip.GetMemSpace());
+    if (pos.GetPosition() == ip.GetPosition()) break;
+    
+    // starting label found
+    const int label_start = pos.GetPosition();
+    pos++;
+    
+    // Check for direct matched label pattern, can be substring of 'label'ed target
+    // - must match all NOPs in search_label
+    // - extra NOPs in 'label'ed target are ignored
+    int size_matched = 0;
+    while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
+      if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
+      size_matched++;
       pos++;
+    }
+    
+    // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
+    if (size_matched == search_label.GetSize()) {
+      pos--;
+      const int found_pos = pos.GetPosition();
       
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.GetPosition();
-        
-        if (mark_executed) {
-          pos.Set(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        return cHeadCPU(this, found_pos, ip.GetMemSpace());
+      if (mark_executed) {
+        pos.Set(label_start);
+        const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+        for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
       }
       
-      continue; 
+      // Return Head pointed at last NOP of label sequence
+      return cHeadCPU(this, found_pos, ip.GetMemSpace());
     }
-    pos++;
   }
   
   // Return start point if not found
@@ -1146,33 +1151,35 @@ cHeadCPU cHardwareExperimental::FindNopSequenceForward(bool mark_executed)
   pos++;
   
   while (pos.GetPosition() != ip.GetPosition()) {
-    if (m_inst_set->IsNop(pos.GetInst())) { // starting label found
-      const int label_start = pos.GetPosition();
+    pos.Set(m_label_index.NextNop(pos.GetPosition(), ip.GetPosition()), ip.GetMemSpace());
+    if (pos.GetPosition() == ip.GetPosition()) break;
+    
+    // starting label found
+    const int label_start = pos.GetPosition();
+    
+    // Check for direct matched nop sequence, can be substring of target
+    // - must match all NOPs in search_label
+    // - extra NOPs in target are ignored
+    int size_matched = 0;
+    while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
+      if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
+      size_matched++;
+      pos++;
+    }
+    
+    // Check that the label matches and has examined the full sequence of nops
+    if (size_matched == search_label.GetSize()) {
+      pos--;
+      const int found_pos = pos.GetPosition();
       
-      // Check for direct matched nop sequence, can be substring of target
-      // - must match all NOPs in search_label
-      // - extra NOPs in target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
+      if (mark_executed) {
+        pos.Set(label_start);
+        const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+        for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
       }
       
-      // Check that the label matches and has examined the full sequence of nops
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.GetPosition();
-        
-        if (mark_executed) {
-          pos.Set(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        return cHeadCPU(this, found_pos, ip.GetMemSpace());
-      }
+      // Return Head pointed at last NOP of label sequence
+      return cHeadCPU(this, found_pos, ip.GetMemSpace());
     }
     
     if (pos.GetPosition() == ip.GetPosition()) break;
@@ -4555,7 +4562,7 @@ bool cHardwareExperimental::Inst_NopCollectEdible(cAvidaContext& ctx)
 bool cHardwareExperimental::Inst_GetResStored(cAvidaContext& ctx)
 {
   int resource_id = abs(GetRegister(FindModifiedRegister(rBX)));
-  tArray<double> bins = m_organism->GetRBins();
+  const tArraySlice<double>& bins = m_organism->GetRBins();
   resource_id %= bins.GetSize();
   int out_reg = FindModifiedRegister(rBX);
   setInternalValue(out_reg, (int)(bins[resource_id]), true);
@@ -4564,7 +4571,7 @@ bool cHardwareExperimental::Inst_GetResStored(cAvidaContext& ctx)
 
 bool cHardwareExperimental::Inst_GetSpecificStored(cAvidaContext& ctx)
 {
-  tArray<double> bins = m_organism->GetRBins();
+  const tArraySlice<double>& bins = m_organism->GetRBins();
   int out_reg = FindModifiedRegister(rBX);
   setInternalValue(out_reg, (int)(bins[m_world->GetConfig().COLLECT_SPECIFIC_RESOURCE.Get()]), true);
   return true;
@@ -4871,8 +4878,8 @@ bool cHardwareExperimental::Inst_AttackPrey(cAvidaContext& ctx)
     }
     
     // now add on the victims reaction counts to your own, this will allow you to pass any reaction tests...
-    tArray<int> target_reactions = target->GetPhenotype().GetLastReactionCount();
-    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount();
+    const tArraySlice<int>& target_reactions = target->GetPhenotype().GetLastReactionCount();
+    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount().AsArray();
     for (int i = 0; i < org_reactions.GetSize(); i++) {
       org_reactions[i] += target_reactions[i];
       m_organism->GetPhenotype().SetStolenReactionCount(i, org_reactions[i]);
@@ -4884,7 +4891,7 @@ bool cHardwareExperimental::Inst_AttackPrey(cAvidaContext& ctx)
     
     // now add the victims internal resource bins to your own, if enabled, after correcting for conversion efficiency
     if (m_world->GetConfig().USE_RESOURCE_BINS.Get()) {
-      tArray<double> target_bins = target->GetRBins();
+      const tArraySlice<double>& target_bins = target->GetRBins();
       for (int i = 0; i < target_bins.GetSize(); i++) {
         m_organism->AddToRBin(i, target_bins[i] * m_world->GetConfig().PRED_EFFICIENCY.Get());
       }
@@ -4970,8 +4977,8 @@ bool cHardwareExperimental::Inst_AttackFTPrey(cAvidaContext& ctx)
     }
     
     // now add on the victims reaction counts to your own, this will allow you to pass any reaction tests...
-    tArray<int> target_reactions = target->GetPhenotype().GetLastReactionCount();
-    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount();
+    const tArraySlice<int>& target_reactions = target->GetPhenotype().GetLastReactionCount();
+    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount().AsArray();
     for (int i = 0; i < org_reactions.GetSize(); i++) {
       org_reactions[i] += target_reactions[i];
       m_organism->GetPhenotype().SetStolenReactionCount(i, org_reactions[i]);
@@ -4983,7 +4990,7 @@ bool cHardwareExperimental::Inst_AttackFTPrey(cAvidaContext& ctx)
     
     // now add the victims internal resource bins to your own, if enabled, after correcting for conversion efficiency
     if (m_world->GetConfig().USE_RESOURCE_BINS.Get()) {
-      tArray<double> target_bins = target->GetRBins();
+      const tArraySlice<double>& target_bins = target->GetRBins();
       for (int i = 0; i < target_bins.GetSize(); i++) {
         m_organism->AddToRBin(i, target_bins[i] * m_world->GetConfig().PRED_EFFICIENCY.Get());
       }
@@ -5240,8 +5247,8 @@ bool cHardwareExperimental::Inst_AttackPred(cAvidaContext& ctx)
       m_organism->UpdateMerit(attacker_merit);
     }
     
-    tArray<int> target_reactions = target->GetPhenotype().GetLastReactionCount();
-    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount();
+    const tArraySlice<int>& target_reactions = target->GetPhenotype().GetLastReactionCount();
+    tArray<int> org_reactions = m_organism->GetPhenotype().GetStolenReactionCount().AsArray();
     for (int i = 0; i < org_reactions.GetSize(); i++) {
       org_reactions[i] += target_reactions[i];
       m_organism->GetPhenotype().SetStolenReactionCount(i, org_reactions[i]);
@@ -5251,7 +5258,7 @@ bool cHardwareExperimental::Inst_AttackPred(cAvidaContext& ctx)
     m_organism->GetPhenotype().SetCurBonus(m_organism->GetPhenotype().GetCurBonus() + (target_bonus * m_world->GetConfig().PRED_EFFICIENCY.Get()));
     
     if (m_world->GetConfig().USE_RESOURCE_BINS.Get()) {
-      tArray<double> target_bins = target->GetRBins();
+      const tArraySlice<double>& target_bins = target->GetRBins();
       for (int i = 0; i < target_bins.GetSize(); i++) {
         m_organism->AddToRBin(i, target_bins[i] * m_world->GetConfig().PRED_EFFICIENCY.Get());
       }
@@ -5999,7 +6006,7 @@ void cHardwareExperimental::InjureOrg(cOrganism* target, double injury)
     target_merit -= target_merit * injury;
     target->UpdateMerit(target_merit);
   }
-  tArray<int> target_reactions = target->GetPhenotype().GetLastReactionCount();
+  const tArraySlice<int>& target_reactions = target->GetPhenotype().GetLastReactionCount();
   for (int i = 0; i < target_reactions.GetSize(); i++) {
     target->GetPhenotype().SetReactionCount(i, target_reactions[i] - (int)((target_reactions[i] * injury)));
   }
@@ -6007,7 +6014,7 @@ void cHardwareExperimental::InjureOrg(cOrganism* target, double injury)
   target->GetPhenotype().SetCurBonus(target_bonus - (target_bonus * injury));
   
   if (m_world->GetConfig().USE_RESOURCE_BINS.Get()) {
-    tArray<double> target_bins = target->GetRBins();
+    const tArraySlice<double>& target_bins = target->GetRBins();
     for (int i = 0; i < target_bins.GetSize(); i++) {
       target->AddToRBin(i, -1 * (target_bins[i] * injury));
     }
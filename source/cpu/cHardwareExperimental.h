@@ -32,6 +32,7 @@
 #include "cEnvironment.h"
 #include "cHardwareBase.h"
 #include "cHeadCPU.h"
+#include "cLabelIndex.h"
 #include "cOrgSensor.h"
 #include "cStats.h"
 #include "cString.h"
@@ -185,6 +186,7 @@ private:
   const tMethod* m_functions;
   
   cCPUMemory m_memory;          // Memory...
+  cLabelIndex m_label_index;    // Nop runs and label instructions in memory, for label searches
   cLocalStack m_global_stack;     // A stack that all threads share.
   
   tArray<cLocalThread> m_threads;
@@ -239,6 +241,10 @@ public:
   static cString GetDefaultInstFilename() { return "instset-experimental.cfg"; }
   
   
+  bool SupportsRecycling() const { return true; }
+  void Recycle(cAvidaContext& ctx, cOrganism* in_organism);
+  
+  
   // --------  Core Execution Methods  --------
   bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
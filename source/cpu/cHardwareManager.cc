@@ -51,6 +51,9 @@ cHardwareManager::cHardwareManager(cWorld* world)
 
 cHardwareManager::~cHardwareManager()
 {
+  for (int i = 0; i < m_free_hardware.GetSize(); i++) {
+    for (int j = 0; j < m_free_hardware[i].GetSize(); j++) delete m_free_hardware[i][j];
+  }
   for (int i = 0; i < m_inst_sets.GetSize(); i++) delete m_inst_sets[i];
 }
 
@@ -146,6 +149,7 @@ bool cHardwareManager::loadInstSet(int hw_type, const cString& name, cStringList
   int inst_set_id = m_inst_sets.GetSize();
   m_inst_sets.Push(inst_set);
   m_is_name_map.Set(name, inst_set_id);
+  m_free_hardware.Resize(m_inst_sets.GetSize());
   
   tArray<cString> names(inst_set->GetSize());
   for (int i = 0; i < inst_set->GetSize(); i++) names[i] = inst_set->GetName(i);
@@ -232,7 +236,11 @@ cHardwareBase* cHardwareManager::Create(cAvidaContext& ctx, cOrganism* org, cons
   if (inst_set->GetHardwareType() != mg.GetHardwareType()) return NULL; // inst_set/hw_type mismatch
   
   cHardwareBase* hw = 0;
-  switch (inst_set->GetHardwareType()) {
+  tSmartArray<cHardwareBase*>& free_hw = m_free_hardware[inst_set_id];
+  if (free_hw.GetSize()) {
+    hw = free_hw.Pop();
+    hw->Recycle(ctx, org);
+  } else switch (inst_set->GetHardwareType()) {
     case HARDWARE_TYPE_CPU_ORIGINAL:
       hw = new cHardwareCPU(ctx, m_world, org, inst_set);
       break;
@@ -264,6 +272,23 @@ cHardwareBase* cHardwareManager::Create(cAvidaContext& ctx, cOrganism* org, cons
   return hw;
 }
 
+void cHardwareManager::Release(cHardwareBase* hw)
+{
+  // Necrotic allocation exposes the memory left over from earlier genomes, which must remain the organism's own
+  if (!hw->SupportsRecycling() || m_world->GetConfig().ALLOC_METHOD.Get() == ALLOC_METHOD_NECRO) {
+    delete hw;
+    return;
+  }
+  
+  for (int i = 0; i < m_inst_sets.GetSize(); i++) {
+    if (m_inst_sets[i] == &hw->GetInstSet()) {
+      m_free_hardware[i].Push(hw);
+      return;
+    }
+  }
+  delete hw;
+}
+
 bool cHardwareManager::RegisterInstSet(const cString& name, cInstSet* inst_set)
 {
   if (m_is_name_map.HasEntry(name)) return false;
@@ -271,6 +296,7 @@ bool cHardwareManager::RegisterInstSet(const cString& name, cInstSet* inst_set)
   int inst_set_id = m_inst_sets.GetSize();
   m_inst_sets.Push(inst_set);
   m_is_name_map.Set(name, inst_set_id);  
+  m_free_hardware.Resize(m_inst_sets.GetSize());
   
   return true;
 }
@@ -24,6 +24,7 @@
 
 #include "cTestCPU.h"
 #include "tDictionary.h"
+#include "tSmartArray.h"
 
 namespace Avida {
   class Genome;
@@ -47,6 +48,7 @@ private:
   cWorld* m_world;
   tArray<cInstSet*> m_inst_sets;
   tDictionary<int> m_is_name_map;
+  tArray<tSmartArray<cHardwareBase*> > m_free_hardware;  // Released hardware awaiting reuse, by instruction set
   
   cHardwareManager(); // @not_implemented
   cHardwareManager(const cHardwareManager&); // @not_implemented
@@ -61,6 +63,9 @@ public:
   bool ConvertLegacyInstSetFile(cString filename, cStringList& str_list, cUserFeedback* feedback = NULL);
   
   cHardwareBase* Create(cAvidaContext& ctx, cOrganism* org, const Genome& mg);
+  
+  // Takes hardware no longer used by its organism, keeping it for reuse by Create() when supported
+  void Release(cHardwareBase* hw);
   inline cTestCPU* CreateTestCPU(cAvidaContext& ctx) { return new cTestCPU(ctx, m_world); }
 
   inline bool IsInstSet(const cString& name) const { return m_is_name_map.HasEntry(name); }
@@ -68,6 +73,8 @@ public:
   inline const cInstSet& GetInstSet(const cString& name) const;
   inline cInstSet& GetInstSet(const cString& name);
   const cInstSet& GetInstSet(int i) const { return *m_inst_sets[i]; }
+  // Index of the named instruction set for GetInstSet(int), or -1 for "(default)"
+  inline int GetInstSetID(const cString& name) const { return (name == "(default)") ? -1 : m_is_name_map.Get(name); }
   
   const cInstSet& GetDefaultInstSet() const { return *m_inst_sets[0]; }
   
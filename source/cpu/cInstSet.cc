@@ -27,6 +27,7 @@
 #include "cArgContainer.h"
 #include "cArgSchema.h"
 #include "cAvidaContext.h"
+#include "cFingerprint.h"
 #include "cStringUtil.h"
 #include "cUserFeedback.h"
 #include "cWorld.h"
@@ -43,6 +44,7 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_hw_type(_in.m_hw_type)
   , m_inst_lib(_in.m_inst_lib)
   , m_lib_name_map(_in.m_lib_name_map)
+  , m_decoded(_in.m_decoded)
   , m_mutation_index(NULL)
   , m_has_costs(_in.m_has_costs)
   , m_has_ft_costs(_in.m_has_ft_costs)
@@ -63,6 +65,7 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_hw_type = _in.m_hw_type;
   m_inst_lib = _in.m_inst_lib;
   m_lib_name_map = _in.m_lib_name_map;
+  m_decoded = _in.m_decoded;
   m_mutation_index = NULL;
   m_has_costs = _in.m_has_costs;
   m_has_ft_costs = _in.m_has_ft_costs;
@@ -112,11 +115,23 @@ cInstruction cInstSet::ActivateNullInst()
   m_lib_name_map[inst_id].res_cost = 0.0; 
   m_lib_name_map[inst_id].fem_res_cost = 0.0; 
   m_lib_name_map[inst_id].post_cost = 0;
+  decodeInst(inst_id);
   
   return cInstruction(inst_id);
 }
 
 
+void cInstSet::decodeInst(int inst_id)
+{
+  if (m_decoded.GetSize() <= inst_id) m_decoded.Resize(inst_id + 1);
+  
+  const int fun_id = m_lib_name_map[inst_id].lib_fun_id;
+  m_decoded[inst_id].lib_fun_id = fun_id;
+  m_decoded[inst_id].addl_time_cost = m_lib_name_map[inst_id].addl_time_cost;
+  m_decoded[inst_id].flags = m_inst_lib->Get(fun_id).GetFlags();
+}
+
+
 cString cInstSet::FindBestMatch(const cString& in_name) const
 {
   int best_dist = 1024;
@@ -135,6 +150,31 @@ cString cInstSet::FindBestMatch(const cString& in_name) const
   return best_name;
 }
 
+unsigned long long cInstSet::GetFingerprint() const
+{
+  cFingerprint fingerprint;
+  fingerprint.Add(m_hw_type);
+  
+  for (int i = 0; i < m_lib_name_map.GetSize(); i++) {
+    const sInstEntry& entry = m_lib_name_map[i];
+    fingerprint.Add(m_inst_lib->GetName(entry.lib_fun_id));
+    fingerprint.Add(entry.redundancy);
+    fingerprint.Add(entry.cost);
+    fingerprint.Add(entry.ft_cost);
+    fingerprint.Add(entry.energy_cost);
+    fingerprint.Add(entry.prob_fail);
+    fingerprint.Add(entry.addl_time_cost);
+    fingerprint.Add(entry.inst_code);
+    fingerprint.Add(entry.res_cost);
+    fingerprint.Add(entry.fem_res_cost);
+    fingerprint.Add(entry.female_cost);
+    fingerprint.Add(entry.choosy_female_cost);
+    fingerprint.Add(entry.post_cost);
+  }
+  
+  return fingerprint.GetValue();
+}
+
 bool cInstSet::InstInSet(const cString& in_name) const
 {
   cString best_name("");
@@ -234,6 +274,7 @@ bool cInstSet::LoadWithStringList(const cStringList& sl, cUserFeedback* feedback
     m_lib_name_map[inst_id].female_cost = args->GetInt(4);
     m_lib_name_map[inst_id].choosy_female_cost = args->GetInt(5);
     m_lib_name_map[inst_id].post_cost = args->GetInt(6);
+    decodeInst(inst_id);
     
     if (m_lib_name_map[inst_id].cost > 1) m_has_costs = true;
     if (m_lib_name_map[inst_id].ft_cost) m_has_ft_costs = true;
@@ -86,6 +86,15 @@ public:
   };
   tSmartArray<sInstEntry> m_lib_name_map;
   
+  // Compact copy of the fields needed to dispatch an instruction, kept in step with m_lib_name_map so that the
+  // per-instruction lookups done by the hardware touch as little memory as possible
+  struct sDecodedInst {
+    int lib_fun_id;
+    int addl_time_cost;
+    unsigned int flags;       // nInstFlag flags of the library entry
+  };
+  tSmartArray<sDecodedInst> m_decoded;
+  
   tArray<int> m_lib_nopmod_map;
   
   cOrderedWeightedIndex* m_mutation_index;     // Weighted index for instructions 
@@ -113,6 +122,9 @@ public:
   const cString& GetInstSetName() const { return m_name; }
   int GetHardwareType() const { return m_hw_type; }
 
+  // Returns a hash of the hardware type and of every instruction with its costs, which decide how genomes run
+  unsigned long long GetFingerprint() const;
+
   // Accessors
   const cString& GetName(int id) const { return m_inst_lib->GetName(m_lib_name_map[id].lib_fun_id); }
   const cString& GetName(const cInstruction& inst) const { return GetName(inst.GetOp()); }
@@ -122,7 +134,7 @@ public:
   int GetFTCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].ft_cost; }
   int GetEnergyCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].energy_cost; }
   double GetProbFail(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].prob_fail; }
-  int GetAddlTimeCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].addl_time_cost; }
+  int GetAddlTimeCost(const cInstruction& inst) const { return m_decoded[inst.GetOp()].addl_time_cost; }
   int GetInstructionCode(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].inst_code; }
   double GetResCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].res_cost; }
   double GetFemResCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].fem_res_cost; }
@@ -130,7 +142,8 @@ public:
   int GetChoosyFemaleCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].choosy_female_cost; } //@CHC
   int GetPostCost(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].post_cost; }
   
-  int GetLibFunctionIndex(const cInstruction& inst) const { return m_lib_name_map[inst.GetOp()].lib_fun_id; }
+  int GetLibFunctionIndex(const cInstruction& inst) const { return m_decoded[inst.GetOp()].lib_fun_id; }
+  const sDecodedInst& GetDecodedInst(const cInstruction& inst) const { return m_decoded[inst.GetOp()]; }
 
   int GetNopMod(const cInstruction& inst) const
   {
@@ -155,12 +168,12 @@ public:
   
   // Instruction Analysis.
   int IsNop(const cInstruction& inst) const { return (inst.GetOp() < m_lib_nopmod_map.GetSize()); }
-  bool IsLabel(const cInstruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsLabel(); }
-  bool IsPromoter(const cInstruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsPromoter(); }
-  bool ShouldStall(const cInstruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).ShouldStall(); }
-  bool ShouldSleep(const cInstruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).ShouldSleep(); }
+  bool IsLabel(const cInstruction& inst) const { return (m_decoded[inst.GetOp()].flags & nInstFlag::LABEL); }
+  bool IsPromoter(const cInstruction& inst) const { return (m_decoded[inst.GetOp()].flags & nInstFlag::PROMOTER); }
+  bool ShouldStall(const cInstruction& inst) const { return (m_decoded[inst.GetOp()].flags & nInstFlag::STALL); }
+  bool ShouldSleep(const cInstruction& inst) const { return (m_decoded[inst.GetOp()].flags & nInstFlag::SLEEP); }
   
-  unsigned int GetFlags(const cInstruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).GetFlags(); }
+  unsigned int GetFlags(const cInstruction& inst) const { return m_decoded[inst.GetOp()].flags; }
 
   // Insertion of new instructions...
   cInstruction ActivateNullInst();
@@ -180,6 +193,9 @@ public:
   cInstruction GetInstError() const { return cInstruction(255); }
   
   bool LoadWithStringList(const cStringList& sl, cUserFeedback* errors = NULL);
+  
+private:
+  void decodeInst(int inst_id);
 };
 
 
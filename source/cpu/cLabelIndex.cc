@@ -0,0 +1,272 @@
+/*
+ *  cLabelIndex.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cLabelIndex.h"
+
+#include "cCodeLabel.h"
+#include "cCPUMemory.h"
+#include "cInstSet.h"
+
+#include <cassert>
+
+
+cLabelIndex::cLabelIndex(const cCPUMemory& memory, const cInstSet* inst_set)
+  : m_memory(memory), m_inst_set(inst_set), m_num_runs(0), m_num_labels(0), m_scanned(0), m_labels_scanned(0), m_last_run(0)
+{
+}
+
+
+void cLabelIndex::sync()
+{
+  const int unmodified = m_memory.GetUnmodifiedSize();
+  if (unmodified <= m_scanned) {
+    m_scanned = unmodified;
+
+    // A run reaching the first modified site (perhaps the old end of memory) may have changed length, so it is
+    // dropped along with those after it
+    while (m_num_runs > 0 && m_runs[m_num_runs - 1].end >= unmodified) {
+      m_num_runs--;
+      if (m_runs[m_num_runs].start < m_scanned) m_scanned = m_runs[m_num_runs].start;
+    }
+  }
+  if (unmodified < m_labels_scanned) {
+    m_labels_scanned = unmodified;
+    while (m_num_labels > 0 && m_labels[m_num_labels - 1] >= unmodified) m_num_labels--;
+  }
+  m_memory.ClearModified();
+}
+
+
+// Records the run of nops or skips the single instruction at the scan position, returning false at the end of memory
+bool cLabelIndex::scanNext()
+{
+  const int size = m_memory.GetSize();
+  if (m_scanned >= size) return false;
+
+  if (m_inst_set->IsNop(m_memory[m_scanned])) {
+    const int start = m_scanned;
+    int end = start + 1;
+    while (end < size && m_inst_set->IsNop(m_memory[end])) end++;
+    pushRun(start, end);
+    m_scanned = end;
+  } else {
+    m_scanned++;
+  }
+
+  return true;
+}
+
+// Label instructions are only wanted by cHardwareExperimental, so they are scanned for separately
+bool cLabelIndex::scanNextLabel()
+{
+  if (m_labels_scanned >= m_memory.GetSize()) return false;
+  if (m_inst_set->IsLabel(m_memory[m_labels_scanned])) pushLabel(m_labels_scanned);
+  m_labels_scanned++;
+  return true;
+}
+
+void cLabelIndex::pushRun(int start, int end)
+{
+  // Storage is kept when the index is cut back, so an index rebuilt for each new genome does not reallocate
+  if (m_num_runs == m_runs.GetSize()) m_runs.Resize(m_num_runs + 1);
+  m_runs[m_num_runs].start = start;
+  m_runs[m_num_runs].end = end;
+  m_num_runs++;
+}
+
+void cLabelIndex::pushLabel(int pos)
+{
+  if (m_num_labels == m_labels.GetSize()) m_labels.Resize(m_num_labels + 1);
+  m_labels[m_num_labels++] = pos;
+}
+
+
+// Returns the first run ending after pos (so holding or following it), scanning further into memory as needed
+int cLabelIndex::findRunEndingAfter(int pos)
+{
+  // Searches from a loop usually land on the run found last time
+  const int hint = m_last_run;
+  if (hint < m_num_runs && m_runs[hint].end > pos && (hint == 0 || m_runs[hint - 1].end <= pos)) return hint;
+
+  int lo = 0;
+  int hi = m_num_runs;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_runs[mid].end > pos) hi = mid;
+    else lo = mid + 1;
+  }
+
+  while (lo == m_num_runs) {
+    if (!scanNext()) return -1;
+    if (lo < m_num_runs && m_runs[lo].end <= pos) lo++;
+  }
+  m_last_run = lo;
+  return lo;
+}
+
+// Returns the number of runs starting at or before pos, all of which must already be recorded
+int cLabelIndex::countRunsStartingBy(int pos)
+{
+  const int hint = m_last_run;
+  if (hint < m_num_runs && m_runs[hint].start <= pos && (hint + 1 == m_num_runs || m_runs[hint + 1].start > pos)) {
+    return hint + 1;
+  }
+
+  int lo = 0;
+  int hi = m_num_runs;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_runs[mid].start > pos) hi = mid;
+    else lo = mid + 1;
+  }
+  if (lo > 0) m_last_run = lo - 1;
+  return lo;
+}
+
+int cLabelIndex::findNextRun(int run)
+{
+  while (run + 1 == m_num_runs) if (!scanNext()) return -1;
+  return run + 1;
+}
+
+int cLabelIndex::findNop(int pos)
+{
+  const int run = findRunEndingAfter(pos);
+  if (run < 0) return -1;
+  return (m_runs[run].start > pos) ? m_runs[run].start : pos;
+}
+
+int cLabelIndex::findLabelInst(int pos)
+{
+  int lo = 0;
+  int hi = m_num_labels;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_labels[mid] >= pos) hi = mid;
+    else lo = mid + 1;
+  }
+
+  while (lo == m_num_labels) {
+    if (!scanNextLabel()) return -1;
+    while (lo < m_num_labels && m_labels[lo] < pos) lo++;
+  }
+  return m_labels[lo];
+}
+
+bool cLabelIndex::matchAt(const cCodeLabel& label, int pos) const
+{
+  for (int i = 0; i < label.GetSize(); i++) {
+    if (label[i] != m_inst_set->GetNopMod(m_memory[pos + i])) return false;
+  }
+  return true;
+}
+
+
+int cLabelIndex::FindForward(const cCodeLabel& label, int pos)
+{
+  assert(pos >= 0 && pos < m_memory.GetSize());
+  sync();
+
+  // The search begins just past the label following pos, looking at the whole of the run found there (back to pos)
+  // and then at each run after it in turn
+  const int label_size = label.GetSize();
+  if (pos + label_size >= m_memory.GetSize()) return -1;
+
+  for (int run = findRunEndingAfter(pos + label_size); run >= 0; run = findNextRun(run)) {
+    const int start = (m_runs[run].start > pos) ? m_runs[run].start : pos;
+    const int end = m_runs[run].end;
+    for (int offset = start; offset + label_size <= end; offset++) {
+      if (matchAt(label, offset)) return offset + label_size;
+    }
+  }
+
+  return -1;
+}
+
+int cLabelIndex::FindBackward(const cCodeLabel& label, int pos)
+{
+  assert(pos < m_memory.GetSize());
+  sync();
+
+  // The search begins before the label preceding pos, looking at the whole of the run found there (forward to pos)
+  // and then at each run before it in turn
+  const int label_size = label.GetSize();
+  const int last = pos - label_size;
+  if (last < 0) return -1;
+
+  while (m_scanned <= last && scanNext()) ;
+
+  for (int run = countRunsStartingBy(last) - 1; run >= 0; run--) {
+    const int start = m_runs[run].start;
+    const int end = (m_runs[run].end < pos) ? m_runs[run].end : pos;
+    for (int offset = start; offset + label_size <= end; offset++) {
+      if (matchAt(label, offset)) return end;
+    }
+  }
+
+  return -1;
+}
+
+int cLabelIndex::FindSequence(const cCodeLabel& label, int pos)
+{
+  assert(label.GetSize() > 0);
+  sync();
+
+  const int label_size = label.GetSize();
+  for (int run = findRunEndingAfter(pos); run >= 0; run = findNextRun(run)) {
+    const int start = (m_runs[run].start > pos) ? m_runs[run].start : pos;
+    const int end = m_runs[run].end;
+    for (int offset = start; offset + label_size <= end; offset++) {
+      if (matchAt(label, offset)) return offset;
+    }
+  }
+
+  return -1;
+}
+
+
+int cLabelIndex::NextNop(int pos, int stop)
+{
+  if (pos == stop) return stop;
+  sync();
+
+  int found = findNop(pos);
+  if (stop > pos) return (found >= 0 && found < stop) ? found : stop;
+  if (found >= 0) return found;
+
+  // Wrap around to the start of memory
+  found = findNop(0);
+  return (found >= 0 && found < stop) ? found : stop;
+}
+
+int cLabelIndex::NextLabelInst(int pos, int stop)
+{
+  if (pos == stop) return stop;
+  sync();
+
+  int found = findLabelInst(pos);
+  if (stop > pos) return (found >= 0 && found < stop) ? found : stop;
+  if (found >= 0) return found;
+
+  // Wrap around to the start of memory
+  found = findLabelInst(0);
+  return (found >= 0 && found < stop) ? found : stop;
+}
@@ -0,0 +1,96 @@
+/*
+ *  cLabelIndex.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cLabelIndex_h
+#define cLabelIndex_h
+
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
+
+class cCodeLabel;
+class cCPUMemory;
+class cInstSet;
+
+
+// cLabelIndex - the runs of nops and the label instructions in a hardware's memory
+//
+// Label searches step from run to run (or label to label) rather than testing every instruction.  The index is
+// built lazily, only as far into memory as searches have looked, and is kept across searches: when memory changes,
+// only the part from the first modified site on is discarded (see Sequence::GetUnmodifiedSize), so writes to an
+// offspring at the end of memory leave the index over the parent intact.  Results are the same as the linear scans
+// they replace.
+class cLabelIndex
+{
+private:
+  struct sNopRun
+  {
+    int start;
+    int end;  // one past the last nop of the run
+  };
+
+  const cCPUMemory& m_memory;
+  const cInstSet* m_inst_set;
+
+  tSmartArray<sNopRun> m_runs;
+  int m_num_runs;
+  tSmartArray<int> m_labels;
+  int m_num_labels;
+  int m_scanned;        // every run starting before this position is recorded
+  int m_labels_scanned; // every label instruction before this position is recorded
+  int m_last_run;       // run most recently looked up, checked first by the next lookup
+
+  void sync();
+  bool scanNext();
+  bool scanNextLabel();
+  void pushRun(int start, int end);
+  void pushLabel(int pos);
+
+  int findRunEndingAfter(int pos);
+  int countRunsStartingBy(int pos);
+  int findNextRun(int run);
+  int findNop(int pos);
+  int findLabelInst(int pos);
+  bool matchAt(const cCodeLabel& label, int pos) const;
+
+  cLabelIndex(); // @not_implemented
+  cLabelIndex(const cLabelIndex&); // @not_implemented
+  cLabelIndex& operator=(const cLabelIndex&); // @not_implemented
+
+public:
+  cLabelIndex(const cCPUMemory& memory, const cInstSet* inst_set);
+
+  // Searches of cHardwareCPU, returning -1 if label is not found.  Forward searches start past the label that follows
+  // pos and return the position after the first match, backward searches end before pos and return the end of the
+  // nop run (up to pos) holding the match.  Matches may be anywhere inside longer runs of nops.
+  int FindForward(const cCodeLabel& label, int pos);
+  int FindBackward(const cCodeLabel& label, int pos);
+
+  // Returns the first position at or after pos where the nops of label appear in order, or -1
+  int FindSequence(const cCodeLabel& label, int pos);
+
+  // Circular scans for cHardwareExperimental, returning the first nop (or label instruction) at or after pos, or stop
+  // if it is reached first
+  int NextNop(int pos, int stop);
+  int NextLabelInst(int pos, int stop);
+};
+
+#endif
@@ -51,9 +51,15 @@ cTestCPU::cTestCPU(cAvidaContext& ctx, cWorld* world)
 {
   m_world = world;
 	m_use_manual_inputs = false;
+  m_reuse_orgs = m_world->GetConfig().RECYCLE_ORGANISMS.Get();
   InitResources(ctx);
 }  
 
+cTestCPU::~cTestCPU()
+{
+  for (int i = 0; i < m_spare_orgs.GetSize(); i++) delete m_spare_orgs[i];
+}
+
  
 void cTestCPU::InitResources(cAvidaContext& ctx, int res_method, cResourceHistory* res, int update, int cpu_cycle_offset)
 {  
@@ -213,6 +219,7 @@ bool cTestCPU::ProcessGestation(cAvidaContext& ctx, cCPUTestInfo& test_info, int
 bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome)
 {
   ctx.SetTestMode();
+  reclaimOrganisms(test_info);
   test_info.Clear();
   TestGenome_Body(ctx, test_info, genome, 0);
   ctx.ClearTestMode();
@@ -223,6 +230,7 @@ bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Gen
 bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, ofstream& out_fp)
 {
   ctx.SetTestMode();
+  reclaimOrganisms(test_info);
   test_info.Clear();
   TestGenome_Body(ctx, test_info, genome, 0);
 
@@ -281,9 +289,16 @@ bool cTestCPU::TestGenome_Body(cAvidaContext& ctx, cCPUTestInfo& test_info, cons
 
   // Setup the organism we're working with now.
   if (test_info.org_array[cur_depth] != NULL) {
-    delete test_info.org_array[cur_depth];
+    if (m_reuse_orgs) m_spare_orgs.Push(test_info.org_array[cur_depth]);
+    else delete test_info.org_array[cur_depth];
+  }
+  cOrganism* organism = NULL;
+  if (m_spare_orgs.GetSize()) {
+    organism = m_spare_orgs.Pop();
+    organism->reload(ctx, genome, -1, SRC_TEST_CPU);
+  } else {
+    organism = new cOrganism(m_world, ctx, genome, -1, SRC_TEST_CPU);
   }
-  cOrganism* organism = new cOrganism(m_world, ctx, genome, -1, SRC_TEST_CPU);
   
   // Copy the test mutation rates
   organism->MutationRates().Copy(test_info.MutationRates());
@@ -347,6 +362,18 @@ bool cTestCPU::TestGenome_Body(cAvidaContext& ctx, cCPUTestInfo& test_info, cons
 }
 
 
+// Takes over the organisms left in test_info by its last test, which remain readable until the next one begins
+void cTestCPU::reclaimOrganisms(cCPUTestInfo& test_info)
+{
+  if (!m_reuse_orgs) return;
+  for (int i = 0; i < test_info.generation_tests; i++) {
+    if (test_info.org_array[i] == NULL) break;
+    m_spare_orgs.Push(test_info.org_array[i]);
+    test_info.org_array[i] = NULL;
+  }
+}
+
+
 void cTestCPU::PrintGenome(cAvidaContext& ctx, const Genome& genome, cString filename, int update, bool for_groups, int last_birth_cell, int last_group_id, int last_forager_type)
 {
   if (filename == "") filename.Set("archive/%03d-unnamed.org", genome.GetSize());
@@ -409,8 +436,8 @@ void cTestCPU::PrintGenome(cAvidaContext& ctx, const Genome& genome, cString fil
   df.WriteComment("Tasks Performed:");
   
   const cEnvironment& env = m_world->GetEnvironment();
-  const tArray<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
-  const tArray<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
+  const tArraySlice<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
+  const tArraySlice<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
   for (int i = 0; i < task_count.GetSize(); i++) {
     df.WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
                           task_count[i], task_qual[i]));
@@ -420,16 +447,16 @@ void cTestCPU::PrintGenome(cAvidaContext& ctx, const Genome& genome, cString fil
   if(m_world->GetConfig().USE_RESOURCE_BINS.Get())  {
   	df.WriteComment("Tasks Performed Using Internal Resources:");
   	
-  	const tArray<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
-  	const tArray<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
+  	const tArraySlice<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
+  	const tArraySlice<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
   	
   	for (int i = 0; i < task_count.GetSize(); i++) {
   		df.WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
   		                      internal_task_count[i], internal_task_qual[i]));
   	}
   	
-  	const tArray<double>& rbins_total = test_info.GetTestPhenotype().GetLastRBinsTotal();
-  	const tArray<double>& rbins_avail = test_info.GetTestPhenotype().GetLastRBinsAvail();
+  	const tArraySlice<double>& rbins_total = test_info.GetTestPhenotype().GetLastRBinsTotal();
+  	const tArraySlice<double>& rbins_avail = test_info.GetTestPhenotype().GetLastRBinsAvail();
   	
   	df.WriteComment(        "Resources Collected: Name\t\tTotal\t\tAvailable");
   	for (int i = 0; i < rbins_total.GetSize(); i++) {
@@ -514,8 +541,8 @@ void cTestCPU::PrintBioGroup(cAvidaContext& ctx, cBioGroup* bg, cString filename
   df.WriteComment("Tasks Performed:");
   
   const cEnvironment& env = m_world->GetEnvironment();
-  const tArray<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
-  const tArray<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
+  const tArraySlice<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
+  const tArraySlice<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
   for (int i = 0; i < task_count.GetSize(); i++) {
     df.WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
                           task_count[i], task_qual[i]));
@@ -525,16 +552,16 @@ void cTestCPU::PrintBioGroup(cAvidaContext& ctx, cBioGroup* bg, cString filename
   if(m_world->GetConfig().USE_RESOURCE_BINS.Get())  {
   	df.WriteComment("Tasks Performed Using Internal Resources:");
   	
-  	const tArray<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
-  	const tArray<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
+  	const tArraySlice<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
+  	const tArraySlice<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
   	
   	for (int i = 0; i < task_count.GetSize(); i++) {
   		df.WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
   		                      internal_task_count[i], internal_task_qual[i]));
   	}
   	
-  	const tArray<double>& rbins_total = test_info.GetTestPhenotype().GetLastRBinsTotal();
-  	const tArray<double>& rbins_avail = test_info.GetTestPhenotype().GetLastRBinsAvail();
+  	const tArraySlice<double>& rbins_total = test_info.GetTestPhenotype().GetLastRBinsTotal();
+  	const tArraySlice<double>& rbins_avail = test_info.GetTestPhenotype().GetLastRBinsAvail();
   	
   	df.WriteComment(        "Resources Collected: Name\t\tTotal\t\tAvailable");
   	for (int i = 0; i < rbins_total.GetSize(); i++) {
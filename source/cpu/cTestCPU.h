@@ -28,6 +28,9 @@
 #ifndef tArray_h
 #include "tArray.h"
 #endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
 #ifndef cString_h
 #include "cString.h"
 #endif
@@ -49,6 +52,7 @@ namespace Avida {
 class cAvidaContext;
 class cBioGroup;
 class cInstSet;
+class cOrganism;
 class cResourceCount;
 class cResourceHistory;
 
@@ -79,10 +83,16 @@ private:
   cResourceCount m_faced_cell_resource_count;
   cResourceCount m_deme_resource_count;
   cResourceCount m_cell_resource_count;
+
+  // Organisms of earlier tests, reloaded with each new genome rather than reallocated (with RECYCLE_ORGANISMS).  They
+  // belong to this test CPU alone, so each thread testing with its own cTestCPU needs no locking.
+  bool m_reuse_orgs;
+  tSmartArray<cOrganism*> m_spare_orgs;
     
 
   bool ProcessGestation(cAvidaContext& ctx, cCPUTestInfo& test_info, int cur_depth);
   bool TestGenome_Body(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, int cur_depth);
+  void reclaimOrganisms(cCPUTestInfo& test_info);
 
   
   cTestCPU(); // @not_implemented
@@ -97,7 +107,7 @@ private:
   
 public:
   cTestCPU(cAvidaContext& ctx, cWorld* world);
-  ~cTestCPU() { }
+  ~cTestCPU();
   
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome);
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, std::ofstream& out_fp);
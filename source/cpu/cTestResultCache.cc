@@ -0,0 +1,342 @@
+/*
+ *  cTestResultCache.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cTestResultCache.h"
+
+#include "apto/core/FileSystem.h"
+#include "apto/platform.h"
+#include "avida/core/Genome.h"
+
+#include "cEnvironment.h"
+#include "cFingerprint.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include <cassert>
+#include <cstring>
+
+#if !APTO_PLATFORM(WINDOWS)
+# include <fcntl.h>
+# include <sys/file.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+
+static const char CACHE_FILE_MAGIC[4] = { 'A', 'V', 'T', 'C' };
+static const unsigned int CACHE_FILE_VERSION = 1;
+static const int MEMORY_INITIAL_SIZE = 1024;
+
+
+cTestResultCache::cTestResultCache(cWorld* world, cUserFeedback* feedback)
+  : m_world(world), m_num_records(0), m_fd(-1), m_map(NULL), m_map_size(0), m_header(NULL), m_file_records(NULL)
+  , m_file_writable(false), m_config_changes(-1), m_config_fp(0)
+{
+  assert(sizeof(sRecord) == 64 && sizeof(sFileHeader) == 64);
+
+  m_records.ResizeClear(MEMORY_INITIAL_SIZE);
+  memset(m_records.begin(), 0, m_records.GetSize() * sizeof(sRecord));
+
+  cAvidaConfig& config = m_world->GetConfig();
+  if (config.TEST_CACHE.Get() == 2) {
+    m_filename = cString(Apto::FileSystem::GetAbsolutePath(Apto::String(config.TEST_CACHE_FILE.Get()),
+                                                           Apto::String(m_world->GetWorkingDir())));
+    openFile(m_filename, config.TEST_CACHE_FILE_SIZE.Get(), feedback);
+  }
+}
+
+cTestResultCache::~cTestResultCache()
+{
+  closeFile();
+}
+
+
+#if APTO_PLATFORM(WINDOWS)
+
+void cTestResultCache::openFile(const cString& filename, int, cUserFeedback* feedback)
+{
+  if (feedback) feedback->Warning("test CPU result cache files are not supported on this platform, '%s' not used",
+                                  (const char*)filename);
+}
+
+void cTestResultCache::closeFile() { ; }
+
+bool cTestResultCache::insertFile(const sKey&, const sResult&) { return false; }
+
+#else
+
+void cTestResultCache::openFile(const cString& filename, int capacity, cUserFeedback* feedback)
+{
+  m_fd = open(filename, O_RDWR | O_CREAT, 0644);
+  m_file_writable = (m_fd >= 0);
+  if (m_fd < 0) m_fd = open(filename, O_RDONLY);
+  if (m_fd < 0) {
+    if (feedback) feedback->Warning("unable to open test CPU result cache file '%s'", (const char*)filename);
+    return;
+  }
+
+  // Only the run creating the file sizes it and writes the header, so every opener holds the lock until it has
+  // looked at the header
+  flock(m_fd, m_file_writable ? LOCK_EX : LOCK_SH);
+
+  struct stat st;
+  bool valid = (fstat(m_fd, &st) == 0);
+  if (valid && st.st_size == 0 && m_file_writable) {
+    unsigned long long records = MEMORY_INITIAL_SIZE;
+    while (records < (unsigned long long)capacity) records *= 2;
+    st.st_size = sizeof(sFileHeader) + records * sizeof(sRecord);
+    valid = (ftruncate(m_fd, st.st_size) == 0);
+
+    sFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_FILE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_FILE_VERSION;
+    header.record_size = sizeof(sRecord);
+    header.capacity = records;
+    valid = valid && (pwrite(m_fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header));
+  }
+
+  if (valid && st.st_size >= (off_t)sizeof(sFileHeader)) {
+    m_map_size = st.st_size;
+    m_map = mmap(NULL, m_map_size, PROT_READ | (m_file_writable ? PROT_WRITE : 0), MAP_SHARED, m_fd, 0);
+    if (m_map == MAP_FAILED) m_map = NULL;
+  }
+
+  if (m_map) {
+    sFileHeader* header = static_cast<sFileHeader*>(m_map);
+    const unsigned long long capacity = header->capacity;
+    valid = (memcmp(header->magic, CACHE_FILE_MAGIC, sizeof(header->magic)) == 0 &&
+             header->version == CACHE_FILE_VERSION && header->record_size == sizeof(sRecord) &&
+             capacity > 0 && (capacity & (capacity - 1)) == 0 &&
+             m_map_size == sizeof(sFileHeader) + capacity * sizeof(sRecord));
+    if (valid) {
+      m_header = header;
+      m_file_records = reinterpret_cast<sRecord*>(header + 1);
+    }
+  }
+
+  flock(m_fd, LOCK_UN);
+
+  if (m_header == NULL) {
+    if (feedback) feedback->Warning("'%s' is not a usable test CPU result cache file, results will not be saved",
+                                    (const char*)filename);
+    closeFile();
+  }
+}
+
+void cTestResultCache::closeFile()
+{
+  if (m_map) munmap(m_map, m_map_size);
+  if (m_fd >= 0) close(m_fd);
+  m_map = NULL;
+  m_map_size = 0;
+  m_header = NULL;
+  m_file_records = NULL;
+  m_fd = -1;
+}
+
+bool cTestResultCache::insertFile(const sKey& key, const sResult& result)
+{
+  if (m_header == NULL || !m_file_writable) return false;
+
+  // Leave the file to probe quickly once it is three quarters full
+  const unsigned long long capacity = m_header->capacity;
+  if (m_header->count >= capacity - capacity / 4) return false;
+
+  flock(m_fd, LOCK_EX);
+
+  // Another run may have written this result, or taken the slot, since it was looked for
+  bool inserted = false;
+  const unsigned long long mask = capacity - 1;
+  for (unsigned long long slot = key.slot & mask; ; slot = (slot + 1) & mask) {
+    sRecord& rec = m_file_records[slot];
+    if (rec.state == 0) {
+      if (m_header->count < capacity - capacity / 4) {
+        fill(rec, key, result);
+        m_header->count = m_header->count + 1;
+        inserted = true;
+      }
+      break;
+    }
+    if (matches(rec, key)) {
+      inserted = true;
+      break;
+    }
+  }
+
+  flock(m_fd, LOCK_UN);
+  return inserted;
+}
+
+#endif
+
+
+void cTestResultCache::makeKey(const Genome& genome, sKey& key)
+{
+  // Settings are only refingerprinted after they change; the environment keeps its own fingerprint current, and
+  // instruction sets are not changed once loaded
+  const int config_changes = cAvidaConfig::GetNumChanges();
+  if (config_changes != m_config_changes) {
+    m_config_fp = m_world->GetConfig().GetFingerprint();
+    m_config_changes = config_changes;
+  }
+
+  cHardwareManager& hw_mgr = m_world->GetHardwareManager();
+  int inst_set_id = hw_mgr.GetInstSetID(genome.GetInstSet());
+  if (inst_set_id < 0) inst_set_id = 0;
+  if (inst_set_id >= m_inst_set_fps.GetSize()) {
+    const int old_size = m_inst_set_fps.GetSize();
+    m_inst_set_fps.Resize(hw_mgr.GetNumInstSets());
+    for (int i = old_size; i < m_inst_set_fps.GetSize(); i++) m_inst_set_fps[i] = hw_mgr.GetInstSet(i).GetFingerprint();
+  }
+
+  cFingerprint context;
+  context.Add(m_config_fp);
+  context.Add(m_world->GetEnvironment().GetFingerprint());
+  context.Add(m_inst_set_fps[inst_set_id]);
+  context.Add(genome.GetHardwareType());
+
+  // The sequence hash is kept by the sequence itself, a second hash over its instructions guards against collisions
+  const Sequence& seq = genome.GetSequence();
+  cFingerprint check;
+  for (int i = 0; i < seq.GetSize(); i++) check.Add(seq[i].GetOp());
+
+  key.seq_hash = seq.GetHash();
+  key.context = context.GetValue();
+  key.seq_check = static_cast<unsigned int>(check.GetValue());
+  key.length = seq.GetSize();
+
+  key.slot = slotFor(key.seq_hash, key.context);
+}
+
+unsigned long long cTestResultCache::slotFor(unsigned long long seq_hash, unsigned long long context)
+{
+  cFingerprint slot;
+  slot.Add(seq_hash);
+  slot.Add(context);
+  return slot.GetValue();
+}
+
+bool cTestResultCache::matches(const sRecord& rec, const sKey& key)
+{
+  return (rec.seq_hash == key.seq_hash && rec.context == key.context && rec.seq_check == key.seq_check &&
+          rec.length == key.length);
+}
+
+void cTestResultCache::fill(sRecord& rec, const sKey& key, const sResult& result)
+{
+  rec.seq_hash = key.seq_hash;
+  rec.context = key.context;
+  rec.seq_check = key.seq_check;
+  rec.length = key.length;
+  rec.copied_size = result.copied_size;
+  rec.executed_size = result.executed_size;
+  rec.gestation_time = result.gestation_time;
+  rec.fitness = result.fitness;
+  rec.colony_fitness = result.colony_fitness;
+  rec.merit = result.merit;
+
+  // Readers take a record with its state set to be complete
+  __sync_synchronize();
+  rec.state = STATE_READY | (result.is_viable ? STATE_VIABLE : 0);
+}
+
+void cTestResultCache::extract(const sRecord& rec, sResult& result)
+{
+  result.is_viable = ((rec.state & STATE_VIABLE) != 0);
+  result.fitness = rec.fitness;
+  result.colony_fitness = rec.colony_fitness;
+  result.merit = rec.merit;
+  result.copied_size = rec.copied_size;
+  result.executed_size = rec.executed_size;
+  result.gestation_time = rec.gestation_time;
+}
+
+
+const cTestResultCache::sRecord* cTestResultCache::findIn(const sRecord* records, unsigned long long capacity,
+                                                          const sKey& key) const
+{
+  const unsigned long long mask = capacity - 1;
+  for (unsigned long long slot = key.slot & mask; ; slot = (slot + 1) & mask) {
+    const sRecord& rec = records[slot];
+    if (rec.state == 0) return NULL;
+    __sync_synchronize();
+    if (matches(rec, key)) return &rec;
+  }
+}
+
+void cTestResultCache::insertMemory(const sKey& key, const sResult& result)
+{
+  if ((m_num_records + 1) * 2 > m_records.GetSize()) {
+    tArray<sRecord> old_records(m_records);
+    m_records.ResizeClear(old_records.GetSize() * 2);
+    memset(m_records.begin(), 0, m_records.GetSize() * sizeof(sRecord));
+
+    const unsigned long long mask = m_records.GetSize() - 1;
+    for (int i = 0; i < old_records.GetSize(); i++) {
+      if (old_records[i].state == 0) continue;
+      unsigned long long pos = slotFor(old_records[i].seq_hash, old_records[i].context) & mask;
+      while (m_records[pos].state != 0) pos = (pos + 1) & mask;
+      m_records[pos] = old_records[i];
+    }
+  }
+
+  const unsigned long long mask = m_records.GetSize() - 1;
+  for (unsigned long long slot = key.slot & mask; ; slot = (slot + 1) & mask) {
+    sRecord& rec = m_records[slot];
+    if (rec.state == 0) {
+      fill(rec, key, result);
+      m_num_records++;
+      return;
+    }
+    if (matches(rec, key)) return;
+  }
+}
+
+
+bool cTestResultCache::Find(const Genome& genome, sResult& result)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  sKey key;
+  makeKey(genome, key);
+
+  const sRecord* rec = NULL;
+  if (m_header) rec = findIn(m_file_records, m_header->capacity, key);
+  if (rec == NULL) rec = findIn(m_records.begin(), m_records.GetSize(), key);
+  if (rec == NULL) return false;
+
+  extract(*rec, result);
+  return true;
+}
+
+void cTestResultCache::Insert(const Genome& genome, const sResult& result)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  sKey key;
+  makeKey(genome, key);
+
+  if (!insertFile(key, result)) insertMemory(key, result);
+}
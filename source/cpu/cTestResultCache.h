@@ -0,0 +1,152 @@
+/*
+ *  cTestResultCache.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cTestResultCache_h
+#define cTestResultCache_h
+
+#include "apto/core/Mutex.h"
+
+#ifndef cString_h
+#include "cString.h"
+#endif
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+
+#include <cstddef>
+
+namespace Avida {
+  class Genome;
+};
+class cUserFeedback;
+class cWorld;
+
+using namespace Avida;
+
+
+// cTestResultCache - test CPU results of genomes, found by their contents
+//
+// Results are keyed by the genome's sequence and a context fingerprint of the settings, environment and instruction
+// set it was tested under (see cAvidaConfig::GetFingerprint, cEnvironment::GetFingerprint and cInstSet), so a change
+// to any of them leaves earlier results unused rather than wrong.  With TEST_CACHE 2, results are also kept in a
+// memory mapped file that other runs and analyze sessions share: records are written once, with their state set
+// last, so readers need no lock; writers take an exclusive lock on the file.  A full (or unusable) file leaves
+// further results in memory only.
+class cTestResultCache
+{
+public:
+  struct sResult
+  {
+    bool is_viable;
+    double fitness;
+    double colony_fitness;
+    double merit;
+    int copied_size;
+    int executed_size;
+    int gestation_time;
+  };
+
+private:
+  // 64 bytes, laid out the same in memory and in the file
+  struct sRecord
+  {
+    unsigned long long seq_hash;
+    unsigned long long context;
+    unsigned int seq_check;
+    int length;
+    volatile unsigned int state;  // 0 while empty, then STATE_READY (and STATE_VIABLE)
+    int copied_size;
+    int executed_size;
+    int gestation_time;
+    double fitness;
+    double colony_fitness;
+    double merit;
+  };
+
+  struct sFileHeader
+  {
+    char magic[4];
+    unsigned int version;
+    unsigned int record_size;
+    unsigned int reserved;
+    unsigned long long capacity;
+    volatile unsigned long long count;
+    char padding[32];
+  };
+
+  struct sKey
+  {
+    unsigned long long seq_hash;
+    unsigned long long context;
+    unsigned int seq_check;
+    int length;
+    unsigned long long slot;
+  };
+
+  static const unsigned int STATE_READY = 1;
+  static const unsigned int STATE_VIABLE = 2;
+
+  cWorld* m_world;
+  Apto::Mutex m_mutex;
+
+  tArray<sRecord> m_records;  // in memory results, a power of two in size, at most half full
+  int m_num_records;
+
+  cString m_filename;
+  int m_fd;
+  void* m_map;
+  size_t m_map_size;
+  sFileHeader* m_header;
+  sRecord* m_file_records;
+  bool m_file_writable;
+
+  int m_config_changes;       // cAvidaConfig::GetNumChanges() when m_config_fp was found
+  unsigned long long m_config_fp;
+  tArray<unsigned long long> m_inst_set_fps;
+
+
+  void openFile(const cString& filename, int capacity, cUserFeedback* feedback);
+  void closeFile();
+
+  void makeKey(const Genome& genome, sKey& key);
+  static unsigned long long slotFor(unsigned long long seq_hash, unsigned long long context);
+  static bool matches(const sRecord& rec, const sKey& key);
+  static void fill(sRecord& rec, const sKey& key, const sResult& result);
+  static void extract(const sRecord& rec, sResult& result);
+
+  const sRecord* findIn(const sRecord* records, unsigned long long capacity, const sKey& key) const;
+  bool insertFile(const sKey& key, const sResult& result);
+  void insertMemory(const sKey& key, const sResult& result);
+
+  cTestResultCache(); // @not_implemented
+  cTestResultCache(const cTestResultCache&); // @not_implemented
+  cTestResultCache& operator=(const cTestResultCache&); // @not_implemented
+
+public:
+  cTestResultCache(cWorld* world, cUserFeedback* feedback = NULL);
+  ~cTestResultCache();
+
+  // Returns true, filling in result, if genome has been tested in the current context
+  bool Find(const Genome& genome, sResult& result);
+  void Insert(const Genome& genome, const sResult& result);
+};
+
+#endif
@@ -31,7 +31,7 @@
 #include <cassert>
 
 
-Avida::Data::Manager::Manager(cWorld* world) : m_world(world)
+Avida::Data::Manager::Manager(cWorld* world) : m_world(world), m_last_update(-1), m_next_sample(-1), m_triggered(false)
 {
   
 }
@@ -71,6 +71,8 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder)
   // Make sure that all requested data values are available
   for (ConstDataSetIterator it = requested->Begin(); it.Next();) if (!m_provider_map.Has(*it.Get())) return false;
   
+  if (m_recorders.Has(recorder)) return true;
+  
   // Make sure that all requested data values are active
   for (ConstDataSetIterator it = requested->Begin(); it.Next();) {
     if (!m_active_map.Has(*it.Get())) {
@@ -85,17 +87,55 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder)
         if (!m_active_map.Has(*pit.Get())) m_active_map[*pit.Get()] = provider;
       }
     }
+    
+    // Offer the provider a slot for the value, so that it is stored directly each update
+    if (m_values.FindValue(*it.Get()) < 0) {
+      ProviderPtr provider;
+      m_active_map.Get(*it.Get(), provider);
+      provider->BindProvidedValue(*it.Get(), m_values);
+    }
   }
   
-  // Store the recorder
+  // Store the recorder and merge its schedule
   m_recorders.Insert(recorder);
+  RecorderEntry entry;
+  entry.recorder = recorder;
+  entry.schedule = recorder->GetSchedule();
+  entry.next_sample = entry.schedule.NextSample(m_last_update + 1);
+  bindRecorder(entry);
+  m_recorder_entries.Push(entry);
+  
+  m_provider_due.Resize(m_active_providers.GetSize());
+  updateNextSample();
   return true;
 }
 
 bool Avida::Data::Manager::DetachRecorder(RecorderPtr recorder)
 {
-  // @TODO - this should probably deactivate data providers that are no longer needed, or at least adjust schedule
-  return m_recorders.Remove(recorder);
+  if (!m_recorders.Remove(recorder)) return false;
+  
+  Apto::Array<RecorderEntry> entries;
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    if (m_recorder_entries[i].recorder != recorder) entries.Push(m_recorder_entries[i]);
+  }
+  m_recorder_entries = entries;
+  
+  // Deactivate the data providers that are no longer needed
+  rebuildActive();
+  return true;
+}
+
+
+bool Avida::Data::Manager::TriggerRecorder(RecorderPtr recorder)
+{
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    if (m_recorder_entries[i].recorder == recorder) {
+      m_recorder_entries[i].triggered = true;
+      m_triggered = true;
+      return true;
+    }
+  }
+  return false;
 }
 
 
@@ -111,15 +151,36 @@ bool Avida::Data::Manager::Register(const DataID& data_id, ProviderActivateFunct
 void Avida::Data::Manager::UpdateState(Update current_update)
 {
   m_current_values.Clear();
+  m_last_update = current_update;
+  
+  // Nothing to do until some recorder is due
+  if (!m_triggered && (m_next_sample < 0 || current_update < m_next_sample)) return;
   
-  // Update all of the active providers
-  for (int i = 0; i < m_active_providers.GetSize(); i++) m_active_providers[i]->UpdateProvidedValues(current_update);
+  // Update only the providers that supply the recorders due this update
+  m_provider_due.SetAll(0);
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    const RecorderEntry& entry = m_recorder_entries[i];
+    if (!entry.IsDue(current_update)) continue;
+    for (int p = 0; p < entry.providers.GetSize(); p++) m_provider_due[entry.providers[p]] = 1;
+  }
+  for (int i = 0; i < m_active_providers.GetSize(); i++) {
+    if (m_provider_due[i]) m_active_providers[i]->UpdateProvidedValues(current_update);
+  }
   
   // Notify recorders that new data is available
   DataRetrievalFunctor drf(this, &Manager::GetCurrentValue);
-  for (Apto::Set<RecorderPtr>::Iterator it = m_recorders.Begin(); it.Next();) {
-    (*it.Get())->NotifyData(current_update, drf);
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    RecorderEntry& entry = m_recorder_entries[i];
+    if (!entry.IsDue(current_update)) continue;
+    
+    if (entry.uses_values) entry.recorder->NotifyValues(current_update, m_values);
+    else entry.recorder->NotifyData(current_update, drf);
+    
+    entry.triggered = false;
+    entry.next_sample = entry.schedule.NextSample(current_update + 1);
   }
+  m_triggered = false;
+  updateNextSample();
 }
 
 Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data_id) const
@@ -127,12 +188,95 @@ Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data
   PackagePtr rtn;
   if (m_current_values.Get(data_id, rtn)) return rtn;
   
-  ProviderPtr provider;
-  if (m_active_map.Get(data_id, provider)) {
-    rtn = provider->GetProvidedValue(data_id);
-    if (rtn) m_current_values[data_id] = rtn;
+  const ValueSlot slot = m_values.FindValue(data_id);
+  if (slot >= 0) {
+    rtn = m_values.PackageValue(slot);
+  } else {
+    ProviderPtr provider;
+    if (m_active_map.Get(data_id, provider)) rtn = provider->GetProvidedValue(data_id);
   }
+  if (rtn) m_current_values[data_id] = rtn;
   
   return rtn;
 }
 
+
+void Avida::Data::Manager::bindRecorder(RecorderEntry& entry)
+{
+  entry.uses_values = entry.recorder->BindValues(m_values);
+  
+  // Collect the providers that the recorder draws on
+  entry.providers.Resize(0);
+  ConstDataSetPtr requested = entry.recorder->GetRequested();
+  for (ConstDataSetIterator it = requested->Begin(); it.Next();) {
+    ProviderPtr provider;
+    m_active_map.Get(*it.Get(), provider);
+    
+    int idx = 0;
+    while (m_active_providers[idx] != provider) idx++;
+    
+    bool found = false;
+    for (int p = 0; p < entry.providers.GetSize(); p++) if (entry.providers[p] == idx) found = true;
+    if (!found) entry.providers.Push(idx);
+  }
+}
+
+void Avida::Data::Manager::rebuildActive()
+{
+  DataSet requested;
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    ConstDataSetPtr recorder_requested = m_recorder_entries[i].recorder->GetRequested();
+    for (ConstDataSetIterator it = recorder_requested->Begin(); it.Next();) requested.Insert(*it.Get());
+  }
+  
+  // All slots are reassigned below
+  for (int i = 0; i < m_active_providers.GetSize(); i++) m_active_providers[i]->UnbindProvidedValues();
+  m_values.Clear();
+  m_current_values.Clear();
+  
+  // Keep only the providers that supply at least one requested value
+  Apto::Array<ProviderPtr> active_providers;
+  m_active_map.Clear();
+  for (int i = 0; i < m_active_providers.GetSize(); i++) {
+    ConstDataSetPtr provided = m_active_providers[i]->Provides();
+    bool needed = false;
+    for (ConstDataSetIterator pit = provided->Begin(); pit.Next();) {
+      if (requested.Has(*pit.Get())) {
+        needed = true;
+        break;
+      }
+    }
+    if (!needed) continue;
+    
+    active_providers.Push(m_active_providers[i]);
+    for (ConstDataSetIterator pit = provided->Begin(); pit.Next();) {
+      if (!m_active_map.Has(*pit.Get())) m_active_map[*pit.Get()] = m_active_providers[i];
+    }
+  }
+  m_active_providers = active_providers;
+  m_provider_due.Resize(m_active_providers.GetSize());
+  
+  // Bind the requested values and the remaining recorders again
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    ConstDataSetPtr recorder_requested = m_recorder_entries[i].recorder->GetRequested();
+    for (ConstDataSetIterator it = recorder_requested->Begin(); it.Next();) {
+      if (m_values.FindValue(*it.Get()) < 0) {
+        ProviderPtr provider;
+        m_active_map.Get(*it.Get(), provider);
+        provider->BindProvidedValue(*it.Get(), m_values);
+      }
+    }
+    bindRecorder(m_recorder_entries[i]);
+  }
+  
+  updateNextSample();
+}
+
+void Avida::Data::Manager::updateNextSample()
+{
+  m_next_sample = -1;
+  for (int i = 0; i < m_recorder_entries.GetSize(); i++) {
+    const Update next = m_recorder_entries[i].next_sample;
+    if (next >= 0 && (m_next_sample < 0 || next < m_next_sample)) m_next_sample = next;
+  }
+}
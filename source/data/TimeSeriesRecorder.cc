@@ -25,11 +25,27 @@
 #include "avida/data/TimeSeriesRecorder.h"
 
 #include "avida/data/Package.h"
+#include "avida/data/ValueTable.h"
 
 
 namespace Avida {
   namespace Data {
     
+    template <class T> TimeSeriesRecorder<T>::TimeSeriesRecorder(const DataID& data_id, const SampleSchedule& schedule)
+      : m_data_id(data_id), m_slot(-1), m_schedule(schedule)
+    {
+      DataSetPtr requested(new DataSet);
+      requested->Insert(data_id);
+      m_requested = requested;
+    }
+    
+    template <class T> bool TimeSeriesRecorder<T>::BindValues(const ValueTable& table)
+    {
+      m_slot = table.FindValue(m_data_id);
+      return (m_slot >= 0);
+    }
+    
+    
     template <>
     void TimeSeriesRecorder<PackagePtr>::NotifyData(Update current_update, DataRetrievalFunctor retrieve_data)
     {
@@ -61,6 +77,37 @@ namespace Avida {
       m_data.Push(retrieve_data(m_data_id)->StringValue());
     }
     
+    
+    template <>
+    void TimeSeriesRecorder<PackagePtr>::NotifyValues(Update current_update, const ValueTable& table)
+    {
+      m_data.Push(table.PackageValue(m_slot));
+    }
+    
+    template <>
+    void TimeSeriesRecorder<bool>::NotifyValues(Update current_update, const ValueTable& table)
+    {
+      m_data.Push(table.BoolValue(m_slot));
+    }
+    
+    template <>
+    void TimeSeriesRecorder<int>::NotifyValues(Update current_update, const ValueTable& table)
+    {
+      m_data.Push(table.IntValue(m_slot));
+    }
+    
+    template <>
+    void TimeSeriesRecorder<double>::NotifyValues(Update current_update, const ValueTable& table)
+    {
+      m_data.Push(table.DoubleValue(m_slot));
+    }
+    
+    template <>
+    void TimeSeriesRecorder<Apto::String>::NotifyValues(Update current_update, const ValueTable& table)
+    {
+      m_data.Push(table.StringValue(m_slot));
+    }
+    
   };
 };
 
@@ -78,3 +125,8 @@ template void Avida::Data::TimeSeriesRecorder<bool>::NotifyData(Update, DataRetr
 template void Avida::Data::TimeSeriesRecorder<int>::NotifyData(Update, DataRetrievalFunctor);
 template void Avida::Data::TimeSeriesRecorder<double>::NotifyData(Update, DataRetrievalFunctor);
 template void Avida::Data::TimeSeriesRecorder<Apto::String>::NotifyData(Update, DataRetrievalFunctor);
+template void Avida::Data::TimeSeriesRecorder<Avida::Data::PackagePtr>::NotifyValues(Update, const ValueTable&);
+template void Avida::Data::TimeSeriesRecorder<bool>::NotifyValues(Update, const ValueTable&);
+template void Avida::Data::TimeSeriesRecorder<int>::NotifyValues(Update, const ValueTable&);
+template void Avida::Data::TimeSeriesRecorder<double>::NotifyValues(Update, const ValueTable&);
+template void Avida::Data::TimeSeriesRecorder<Apto::String>::NotifyValues(Update, const ValueTable&);
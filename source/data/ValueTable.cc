@@ -0,0 +1,91 @@
+/*
+ *  data/ValueTable.cc
+ *  avida-core
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Authors: David M. Bryson <david@programerror.com>
+ *
+ */
+
+#include "avida/data/ValueTable.h"
+
+#include "avida/data/Package.h"
+
+
+Avida::Data::ValueSlot Avida::Data::ValueTable::AddValue(const DataID& data_id, ValueType type)
+{
+  ValueSlot slot = -1;
+  if (m_slot_map.Get(data_id, slot)) {
+    assert(m_slots[slot].type == type);
+    return slot;
+  }
+
+  int index = 0;
+  switch (type) {
+    case VALUE_BOOL:
+    case VALUE_INT:     index = m_int_values.GetSize();     m_int_values.Push(0);               break;
+    case VALUE_DOUBLE:  index = m_double_values.GetSize();  m_double_values.Push(0.0);          break;
+    case VALUE_STRING:  index = m_string_values.GetSize();  m_string_values.Push(Apto::String()); break;
+  }
+
+  slot = m_slots.GetSize();
+  m_slots.Push(SlotInfo(type, index));
+  m_slot_map[data_id] = slot;
+  return slot;
+}
+
+Avida::Data::ValueSlot Avida::Data::ValueTable::FindValue(const DataID& data_id) const
+{
+  ValueSlot slot = -1;
+  if (m_slot_map.Get(data_id, slot)) return slot;
+  return -1;
+}
+
+void Avida::Data::ValueTable::Clear()
+{
+  m_slot_map.Clear();
+  m_slots.Resize(0);
+  m_int_values.Resize(0);
+  m_double_values.Resize(0);
+  m_string_values.Resize(0);
+}
+
+
+Apto::String Avida::Data::ValueTable::StringValue(ValueSlot slot) const
+{
+  const SlotInfo& info = m_slots[slot];
+  switch (info.type) {
+    case VALUE_BOOL:    return Apto::AsStr(m_int_values[info.index] != 0);
+    case VALUE_INT:     return Apto::AsStr(m_int_values[info.index]);
+    case VALUE_DOUBLE:  return Apto::AsStr(m_double_values[info.index]);
+    case VALUE_STRING:  return m_string_values[info.index];
+  }
+  return Apto::String();
+}
+
+Avida::Data::PackagePtr Avida::Data::ValueTable::PackageValue(ValueSlot slot) const
+{
+  const SlotInfo& info = m_slots[slot];
+  switch (info.type) {
+    case VALUE_BOOL:    return PackagePtr(new Wrap<bool>(m_int_values[info.index] != 0));
+    case VALUE_INT:     return PackagePtr(new Wrap<int>(m_int_values[info.index]));
+    case VALUE_DOUBLE:  return PackagePtr(new Wrap<double>(m_double_values[info.index]));
+    case VALUE_STRING:  return PackagePtr(new Wrap<Apto::String>(m_string_values[info.index]));
+  }
+  return PackagePtr();
+}
@@ -24,9 +24,11 @@
 #include "cAvidaContext.h"
 #include "cBGGenotype.h"
 #include "cClassificationManager.h"
+#include "cDataFileManager.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cOrganism.h"
+#include "cParallelUpdate.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStats.h"
@@ -75,6 +77,19 @@ void cDefaultRunDriver::Run()
     ActiveProcessStep = &cPopulation::ProcessStepSpeculative;
   }
   
+  // Parallel update pre-executes organisms in spatial tiles, leaving the speculative schedule to consume the results
+  cParallelUpdate* parallel_update = NULL;
+  if (m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get() != 0) {
+    if (ActiveProcessStep == &cPopulation::ProcessStepSpeculative) {
+      parallel_update = new cParallelUpdate(m_world, m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get(),
+                                            m_world->GetConfig().PARALLEL_TILE_SIZE.Get());
+    } else {
+      NotifyWarning("PARALLEL_UPDATE_THREADS requires speculative execution, running single threaded.");
+    }
+  }
+  
+  const int flush_interval = m_world->GetConfig().DATA_FILE_FLUSH_INTERVAL.Get();
+  
   cAvidaContext& ctx = m_world->GetDefaultContext();
   
   while (!m_done) {
@@ -99,6 +114,8 @@ void cDefaultRunDriver::Run()
       const int UD_size = m_world->CalculateUpdateSize();
       const double step_size = 1.0 / (double) UD_size;
       
+      if (parallel_update && population.GetNumOrganisms() > 0) parallel_update->PrefetchUpdate();
+      
       for (int i = 0; i < UD_size; i++) {
         if(population.GetNumOrganisms() == 0) {
           break;
@@ -111,6 +128,9 @@ void cDefaultRunDriver::Run()
     population.ProcessPostUpdate(ctx);
     
 		m_world->ProcessPostUpdate(ctx);
+    
+    // Periodically push buffered data file output to disk
+    if (flush_interval > 0 && stats.GetUpdate() % flush_interval == 0) m_world->GetDataFileManager().FlushAll();
         
     // No viewer; print out status for this update....
     if (m_world->GetVerbosity() > VERBOSE_SILENT) {
@@ -155,6 +175,8 @@ void cDefaultRunDriver::Run()
 			m_done = true;
 		}
   }
+  
+  delete parallel_update;
 }
 
 void cDefaultRunDriver::RaiseException(const cString& in_string)
@@ -0,0 +1,188 @@
+/*
+ *  cParallelUpdate.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cParallelUpdate.h"
+
+#include "apto/platform.h"
+#include "avida/core/WorldDriver.h"
+
+#include "cHardwareBase.h"
+#include "cParallelUpdateWorker.h"
+#include "cPopulation.h"
+#include "cPopulationCell.h"
+#include "cStats.h"
+#include "cString.h"
+#include "cStringUtil.h"
+#include "cWorld.h"
+
+using namespace Avida;
+
+
+// Matches the speculative execution limit used by cPopulation::ProcessStepSpeculative
+static const int MAX_PREFETCH_INST = 32;
+
+
+cParallelUpdate::cParallelUpdate(cWorld* world, int num_threads, int tile_size)
+: m_world(world), m_max_prefetch(MAX_PREFETCH_INST), m_next_tile(0), m_pending(0), m_pass(0), m_terminate(false)
+{
+  buildTiles(tile_size);
+
+  if (num_threads < 0) num_threads = Apto::Platform::AvailableCPUs();
+  if (num_threads > m_tiles.GetSize()) num_threads = m_tiles.GetSize();
+
+  // The calling thread participates in every pass, so only spawn the additional workers
+  if (num_threads > 1) {
+    m_workers.Resize(num_threads - 1);
+    for (int i = 0; i < m_workers.GetSize(); i++) {
+      m_workers[i] = new cParallelUpdateWorker(this);
+      m_workers[i]->Start();
+    }
+  }
+
+  if (m_world->GetVerbosity() >= VERBOSE_DETAILS) {
+    m_world->GetDriver().NotifyComment(cStringUtil::Stringf("parallel update: %d tiles on %d threads",
+                                                            m_tiles.GetSize(), GetNumThreads()));
+  }
+}
+
+cParallelUpdate::~cParallelUpdate()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+
+  for (int i = 0; i < m_tiles.GetSize(); i++) delete m_tiles[i];
+}
+
+
+void cParallelUpdate::buildTiles(int tile_size)
+{
+  cPopulation& pop = m_world->GetPopulation();
+
+  if (tile_size < 1) tile_size = 1;
+  const int tiles_x = (pop.GetWorldX() + tile_size - 1) / tile_size;
+  const int tiles_y = (pop.GetWorldY() + tile_size - 1) / tile_size;
+
+  // Count the cells that fall in each tile, so that cell lists can be sized once
+  tArray<int> tile_counts(tiles_x * tiles_y, 0);
+  tArray<int> cell_tile(pop.GetSize());
+  for (int i = 0; i < pop.GetSize(); i++) {
+    int x, y;
+    pop.GetCell(i).GetPosition(x, y);
+    cell_tile[i] = (y / tile_size) * tiles_x + (x / tile_size);
+    tile_counts[cell_tile[i]]++;
+  }
+
+  // Drop empty tiles (possible in irregular geometries), keeping tile order stable for determinism
+  tArray<int> tile_index(tile_counts.GetSize(), -1);
+  for (int t = 0; t < tile_counts.GetSize(); t++) {
+    if (tile_counts[t] == 0) continue;
+    tile_index[t] = m_tiles.GetSize();
+    sTile* tile = new sTile(m_world);
+    tile->cells.Resize(tile_counts[t]);
+    tile_counts[t] = 0;
+    m_tiles.Push(tile);
+  }
+
+  for (int i = 0; i < pop.GetSize(); i++) {
+    const int t = cell_tile[i];
+    m_tiles[tile_index[t]]->cells[tile_counts[t]++] = i;
+  }
+
+  for (int t = 0; t < m_tiles.GetSize(); t++) {
+    if (m_world->GetDefaultContext().OrgFaultReporting()) m_tiles[t]->ctx.EnableOrgFaultReporting();
+  }
+}
+
+
+void cParallelUpdate::PrefetchUpdate()
+{
+  // Draw every tile seed from the world RNG in tile order so that the world stream advances identically for any
+  // number of threads
+  cRandom& world_rng = m_world->GetRandom();
+  for (int t = 0; t < m_tiles.GetSize(); t++) {
+    m_tiles[t]->rng.ResetSeed(world_rng.GetInt(0x7FFFFFFF));
+    m_tiles[t]->spec_total = 0;
+    m_tiles[t]->spec_num = 0;
+  }
+
+  m_mutex.Lock();
+  m_next_tile = 0;
+  m_pending = m_workers.GetSize();
+  m_pass++;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+
+  processTiles();
+
+  // Barrier - all tiles must be complete before the serial phase resumes
+  m_mutex.Lock();
+  while (m_pending > 0) m_done_cond.Wait(m_mutex);
+  m_mutex.Unlock();
+
+  // Reconcile per-tile statistics in tile order
+  cStats& stats = m_world->GetStats();
+  for (int t = 0; t < m_tiles.GetSize(); t++) stats.AddSpeculative(m_tiles[t]->spec_total, m_tiles[t]->spec_num);
+}
+
+
+void cParallelUpdate::processTiles()
+{
+  while (true) {
+    m_mutex.Lock();
+    const int tile_id = m_next_tile++;
+    m_mutex.Unlock();
+
+    if (tile_id >= m_tiles.GetSize()) break;
+    prefetchTile(*m_tiles[tile_id]);
+  }
+}
+
+
+void cParallelUpdate::prefetchTile(sTile& tile)
+{
+  cPopulation& pop = m_world->GetPopulation();
+
+  for (int i = 0; i < tile.cells.GetSize(); i++) {
+    cPopulationCell& cell = pop.GetCell(tile.cells[i]);
+
+    // Skip empty cells and organisms that still hold unused speculative credit
+    if (!cell.IsOccupied() || cell.GetSpeculativeState()) continue;
+
+    cHardwareBase* hw = cell.GetHardware();
+    if (!hw->SupportsSpeculative()) continue;
+
+    int spec_count = 0;
+    while (spec_count < m_max_prefetch && hw->SingleProcess(tile.ctx, true)) spec_count++;
+
+    if (spec_count) {
+      cell.SetSpeculativeState(spec_count);
+      tile.spec_total += spec_count;
+      tile.spec_num++;
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ *  cParallelUpdate.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cParallelUpdate_h
+#define cParallelUpdate_h
+
+#include "apto/core.h"
+
+#include "cAvidaContext.h"
+#include "cRandom.h"
+#include "tArray.h"
+
+class cParallelUpdateWorker;
+class cWorld;
+
+
+// cParallelUpdate - splits the population into spatial tiles and pre-executes organisms in each tile concurrently
+//
+// Only instructions that are safe for speculative execution (those not flagged STALL) are run by the workers, so no
+// organism touches another organism, the population, or shared resources during the parallel phase.  All births, deaths,
+// movement and other interactions are performed afterwards by the regular speculative schedule, which consumes the
+// credit built up here.  Each tile owns its own random number generator, reseeded from the world RNG every update, so
+// results are deterministic for a given seed and tile size regardless of the number of threads.
+
+class cParallelUpdate
+{
+  friend class cParallelUpdateWorker;
+
+private:
+  struct sTile
+  {
+    tArray<int> cells;
+    cRandom rng;
+    cAvidaContext ctx;
+    int spec_total;
+    int spec_num;
+
+    sTile(cWorld* world) : ctx(world, rng), spec_total(0), spec_num(0) { ; }
+  };
+
+  cWorld* m_world;
+  tArray<sTile*> m_tiles;
+  int m_max_prefetch;
+
+  tArray<cParallelUpdateWorker*> m_workers;
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_work_cond;
+  Apto::ConditionVariable m_done_cond;
+
+  volatile int m_next_tile;   // next tile to be claimed in the current pass
+  volatile int m_pending;     // count of workers still processing the current pass
+  volatile int m_pass;        // incremented to wake workers for a new pass
+  volatile bool m_terminate;
+
+
+  void buildTiles(int tile_size);
+  void processTiles();
+  void prefetchTile(sTile& tile);
+
+  cParallelUpdate(); // @not_implemented
+  cParallelUpdate(const cParallelUpdate&); // @not_implemented
+  cParallelUpdate& operator=(const cParallelUpdate&); // @not_implemented
+
+public:
+  cParallelUpdate(cWorld* world, int num_threads, int tile_size);
+  ~cParallelUpdate();
+
+  int GetNumTiles() const { return m_tiles.GetSize(); }
+  int GetNumThreads() const { return m_workers.GetSize() + 1; }
+
+  // Run the parallel phase for the current update and wait for all tiles to reach the barrier
+  void PrefetchUpdate();
+};
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ *  cParallelUpdateWorker.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cParallelUpdateWorker.h"
+
+#include "cParallelUpdate.h"
+
+
+void cParallelUpdateWorker::Run()
+{
+  int last_pass = 0;
+
+  while (1) {
+    m_pu->m_mutex.Lock();
+    while (m_pu->m_pass == last_pass && !m_pu->m_terminate) {
+      m_pu->m_work_cond.Wait(m_pu->m_mutex);
+    }
+    if (m_pu->m_terminate) {
+      m_pu->m_mutex.Unlock();
+      break;
+    }
+    last_pass = m_pu->m_pass;
+    m_pu->m_mutex.Unlock();
+
+    m_pu->processTiles();
+
+    m_pu->m_mutex.Lock();
+    int pending = --m_pu->m_pending;
+    m_pu->m_mutex.Unlock();
+    if (!pending) m_pu->m_done_cond.Signal();
+  }
+}
@@ -29,6 +29,7 @@
 #include "AvidaTools.h"
 
 #include "cActionLibrary.h"
+#include "cFingerprint.h"
 #include "cInitFile.h"
 #include "cStringIterator.h"
 #include "cUserFeedback.h"
@@ -42,6 +43,7 @@ using namespace AvidaTools;
 Apto::Mutex cAvidaConfig::global_list_mutex;
 tList<cAvidaConfig::cBaseConfigGroup> cAvidaConfig::global_group_list;
 tList<cAvidaConfig::cBaseConfigCustomFormat> cAvidaConfig::global_format_list;
+volatile int cAvidaConfig::cBaseConfigEntry::s_num_changes = 0;
 
 cAvidaConfig::cBaseConfigEntry::cBaseConfigEntry(const cString& _name,
                                                  const cString& _type, const cString& _def, const cString& _desc)
@@ -345,7 +347,7 @@ void cAvidaConfig::GenerateOverides()
       } else {
         fp << "  " << cur_type << " Get() const { return value; }" << endl;
         fp << "  void Set(" << cur_type
-        << " in_value) { value = in_value; }" << endl;
+        << " in_value) { value = in_value; NoteChange(); }" << endl;
       }
       
       fp << "  cString AsString() { return cStringUtil::Convert(value); }" << endl;
@@ -391,6 +393,7 @@ bool cAvidaConfig::Set(const cString& entry, const cString& val)
     while ((cur_entry = entry_it.Next()) != NULL) {
       if (cur_entry->GetName() == entry) {
         cur_entry->LoadStr(val);
+        cBaseConfigEntry::NoteChange();
         return true;
       }
     }
@@ -435,3 +438,26 @@ void cAvidaConfig::Set(tDictionary<cString>& sets)
     }
   }
 }
+
+
+unsigned long long cAvidaConfig::GetFingerprint() const
+{
+  cFingerprint fingerprint;
+
+  tConstListIterator<cBaseConfigGroup> group_it(m_group_list);
+  const cBaseConfigGroup* cur_group;
+  while ((cur_group = group_it.Next()) != NULL) {
+    if (cur_group->GetName() == "CONFIG_FILE_GROUP") continue;
+
+    tConstListIterator<cBaseConfigEntry> entry_it(cur_group->GetEntryList());
+    const cBaseConfigEntry* cur_entry;
+    while ((cur_entry = entry_it.Next()) != NULL) {
+      const cString& name = cur_entry->GetName();
+      if (name == "VERBOSITY" || name == "RANDOM_SEED" || name.IsSubstring("TEST_CACHE", 0)) continue;
+      fingerprint.Add(name);
+      fingerprint.Add(cur_entry->AsString());
+    }
+  }
+
+  return fingerprint.GetValue();
+}
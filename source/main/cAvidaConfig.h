@@ -85,7 +85,7 @@ public:                                                                       \
     global_group_list.GetLast()->AddEntry(this);                      /* 8 */ \
   }                                                                           \
   TYPE Get() const { return value; }                                  /* 9 */ \
-  void Set(TYPE in_value) { value = in_value; }                               \
+  void Set(TYPE in_value) { value = in_value; NoteChange(); }                 \
   cString AsString() const { return cStringUtil::Convert(value); }    /* 10 */\
 } NAME                                                                /* 11 */\
 
@@ -152,6 +152,8 @@ private:
     // those classes?
     bool use_overide;
     
+    static volatile int s_num_changes; // Settings changed since startup, in any world
+    
   public:
     cBaseConfigEntry(const cString& _name, const cString& _type, const cString& _def, const cString& _desc);
     virtual ~cBaseConfigEntry() { ; }
@@ -169,6 +171,9 @@ private:
 
     void AddAlias(const cString & alias) { config_name.Push(alias); }
 
+    static void NoteChange() { s_num_changes++; }
+    static int GetNumChanges() { return s_num_changes; }
+
     virtual cString AsString() const = 0;
   };
   
@@ -283,6 +288,10 @@ public:
   CONFIG_ADD_VAR(VERBOSITY, int, 1, "0 = No output at all\n1 = Normal output\n2 = Verbose output, detailing progress\n3 = High level of details, as available\n4 = Print Debug Information, as applicable");
   CONFIG_ADD_VAR(RANDOM_SEED, int, 0, "Random number seed (0 for based on time)");
   CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms)");
+  CONFIG_ADD_VAR(PARALLEL_UPDATE_THREADS, int, 0, "Number of threads used to pre-execute organisms each update (requires SPECULATIVE)\n0 = Disabled\n-1 = Use all available CPUs");
+  CONFIG_ADD_VAR(PARALLEL_TILE_SIZE, int, 16, "Width and height, in cells, of the spatial tiles handed to parallel update threads");
+  CONFIG_ADD_VAR(SPATIAL_RES_FLOW_METHOD, int, 0, "Method used to compute diffusion and gravity of spatial resources\n0 = Flat grid stencil kernels\n1 = Original per-cell flow (for comparison)");
+  CONFIG_ADD_VAR(RESOURCE_UPDATE_THREADS, int, 0, "Number of threads used to update spatial resources each update\n0 = Disabled\n-1 = Use all available CPUs");
   CONFIG_ADD_VAR(POPULATION_CAP, int, 0, "Carrying capacity in number of organisms (use 0 for no cap)");
   CONFIG_ADD_VAR(POP_CAP_ELDEST, int, 0, "Carrying capacity in number of organisms (use 0 for no cap). Will kill oldest organism in population, but still use birth method to place new offspring."); 
   
@@ -299,6 +308,10 @@ public:
   // -------- Configuration File config options --------
   CONFIG_ADD_GROUP(CONFIG_FILE_GROUP, "Other configuration Files");
   CONFIG_ADD_VAR(DATA_DIR, cString, "data", "Directory in which config files are found");
+  CONFIG_ADD_VAR(DATA_FILE_BUFFERED, bool, 0, "Buffer data file output in memory and write it from a background thread\n(output reaches disk as buffers fill, at DATA_FILE_FLUSH_INTERVAL, when the population is saved, and on exit)");
+  CONFIG_ADD_VAR(DATA_FILE_FLUSH_INTERVAL, int, 0, "Updates between flushes of all data files (0 = no periodic flush)");
+  CONFIG_ADD_VAR(DATA_FILE_QUEUE_SIZE, int, 64, "Number of filled 64KB output buffers that may wait for the data file writer before output stalls");
+  CONFIG_ADD_VAR(DATA_FILE_FORMAT, int, 0, "Format of data files\n0 = Text\n1 = Binary columnar, convert to text with avida-datconvert (files written as raw text stay text)");
   CONFIG_ADD_VAR(EVENT_FILE, cString, "events.cfg", "File containing list of events during run");
   CONFIG_ADD_VAR(ANALYZE_FILE, cString, "analyze.cfg", "File used for analysis mode");
   CONFIG_ADD_VAR(ENVIRONMENT_FILE, cString, "environment.cfg", "File that describes the environment");
@@ -383,6 +396,7 @@ public:
   CONFIG_ADD_VAR(INHERIT_MERIT, int, 1, "Should merit be inhereted from mother parent? (in asexual)");
   CONFIG_ADD_VAR(INHERIT_MULTITHREAD, int, 0, "Should offspring of parents with multiple threads be marked multithreaded?");
   CONFIG_ADD_ALIAS(INHERIT_MULTI_THREAD_CLASSIFICATION);
+  CONFIG_ADD_VAR(RECYCLE_ORGANISMS, bool, 1, "Reset the organisms, phenotypes and hardware of the dead in place for new births,\ninstead of freeing and allocating them again");
   
 	
 
@@ -469,6 +483,9 @@ public:
   CONFIG_ADD_GROUP(MP_GROUP, "Config options for multiple, distributed populations");
   CONFIG_ADD_VAR(ENABLE_MP, int, 0, "Enable multi-process Avida; 0=disabled (default),\n1=enabled.");
   CONFIG_ADD_VAR(MP_SCHEDULING_STYLE, int, 0, "Style of scheduling:\n0=non-MP aware (default)\n1=MP aware, integrated across worlds.");
+  CONFIG_ADD_VAR(MP_MIGRATION_STYLE, int, 0, "How migrants are exchanged between worlds:\n0=synchronized, delivered at the end of the update they leave (default)\n1=asynchronous, delivered exactly MP_MIGRATION_LAG updates later, without barriers.");
+  CONFIG_ADD_VAR(MP_MIGRATION_LAG, int, 2, "Updates between sending and delivering migrants with MP_MIGRATION_STYLE=1;\nworlds never run more than this many updates ahead of one another.");
+  CONFIG_ADD_VAR(MP_REDUCTION_INTERVAL, int, 1, "Updates between summing population size and merit across worlds for\nMP_SCHEDULING_STYLE=1 (with MP_MIGRATION_STYLE=1 the sums are gathered in the\nbackground and are one interval old).");
 	
   
   // -------- Deme config options --------
@@ -513,6 +530,7 @@ public:
   CONFIG_ADD_VAR(DEMES_TRACK_SHANNON_INFO, int, 0, "Enable shannon mutual information tracking for demes.");
   CONFIG_ADD_VAR(DEMES_MUT_ORGS_ON_REPLICATION, int, 0, "Mutate orgs using germline mutation rates when they are copied to a new deme (using DEMES_SEED_METHOD 1): 0=OFF, 1=ON");
   CONFIG_ADD_VAR(DEMES_ORGS_START_IN_GERM, int, 0, "Are orgs considered part of the germline at start?");
+  CONFIG_ADD_VAR(DEMES_LAZY_RESOURCE_TIME, bool, 0, "Accumulate elapsed time for all deme resources on a single clock and only\napply it when a deme's resources are read or at the end of each update.\nMatches per-instruction deme updates to floating-point tolerance.");
   
   
   // -------- Reversion config options --------
@@ -586,6 +604,9 @@ public:
   CONFIG_ADD_GROUP(GENEOLOGY_GROUP, "Geneology");
   CONFIG_ADD_VAR(THRESHOLD, int, 3, "Number of organisms in a genotype needed for it\n  to be considered viable.");
   CONFIG_ADD_VAR(TEST_CPU_TIME_MOD, int, 20, "Time allocated in test CPUs (multiple of length)");
+  CONFIG_ADD_VAR(TEST_CACHE, int, 0, "Reuse the test CPU results of genomes already tested under the same settings and environment\n0 = Off\n1 = In memory\n2 = In memory and in TEST_CACHE_FILE, shared with other runs and analyze sessions\n(a genome found in the cache is not run again, so random numbers its test would have drawn are not drawn)");
+  CONFIG_ADD_VAR(TEST_CACHE_FILE, cString, "test_cache.dat", "File holding cached test CPU results, created if missing (requires TEST_CACHE 2)\nRuns that change the environment other than through the environment actions should not share a file");
+  CONFIG_ADD_VAR(TEST_CACHE_FILE_SIZE, int, 262144, "Number of results a new TEST_CACHE_FILE can hold (64 bytes each)");
   
 
   // -------- Log File config options --------
@@ -899,6 +920,12 @@ public:
   void Set(tDictionary<cString>& sets);
   
   void GenerateOverides();
+
+  // Returns a hash of the settings that decide how an organism runs, for caches of results that depend on them.
+  // File names, the random seed, verbosity and the test CPU result cache settings are left out, so separate runs can
+  // share results.  The hash only needs recomputing when GetNumChanges() has changed.
+  unsigned long long GetFingerprint() const;
+  static int GetNumChanges() { return cBaseConfigEntry::GetNumChanges(); }
 };
 
 
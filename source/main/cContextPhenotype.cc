@@ -42,3 +42,24 @@ void cContextPhenotype::AddReactionCounts(int number_reactions, tArray<int>& cur
       m_cur_reaction_count[count] += cur_reaction_count[count];
     }
 }
+
+void cContextPhenotype::ResizeCounts(int number_tasks, int number_reactions)
+{
+    // Size both count arrays without adding anything, as AddTaskCounts/AddReactionCounts would with blank arrays.
+    if(m_number_tasks != number_tasks) {
+      m_cur_task_count.ResizeClear(number_tasks);
+      for(int count=0;count<number_tasks;count++) {
+        m_cur_task_count[count] = 0;
+      }
+      m_number_tasks = number_tasks;
+    }
+
+    if(m_number_reactions != number_reactions)
+    {
+      m_cur_reaction_count.ResizeClear(number_reactions);
+      for(int count=0;count<number_reactions;count++) {
+        m_cur_reaction_count[count] = 0;
+      }
+      m_number_reactions = number_reactions;
+    }
+}
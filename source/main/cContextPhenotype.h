@@ -47,6 +47,7 @@ public:
   tArray<int>& GetTaskCounts() { return m_cur_task_count; }
   void AddReactionCounts(int count, tArray<int>& cur_task_count);
   tArray<int>& GetReactionCounts() { return m_cur_reaction_count; }
+  void ResizeCounts(int number_tasks, int number_reactions);
 
 };
 
@@ -1292,9 +1292,10 @@ void cDeme::DoDemeOutput(cAvidaContext& ctx, int value)
   // Not actually set up for deme's using resources during reactions
   tArray<double> res_in;
   tArray<double> rbins_in;
+  tArraySlice<int> reaction_count(m_reaction_count);
 
   // The environment, evaluates if a task and if a resulting reaction were completed
-  bool found = env.TestOutput(ctx, result, taskctx, m_task_count, m_reaction_count, res_in, rbins_in);
+  bool found = env.TestOutput(ctx, result, taskctx, m_task_count, reaction_count, res_in, rbins_in);
 
   // No task completed, end here
   if (found == false) {
@@ -49,6 +49,8 @@
 #include "tArray.h"
 #include "tAutoRelease.h"
 
+#include <climits>
+
 using namespace Avida;
 
 
@@ -1242,6 +1244,8 @@ bool cEnvironment::LoadLine(cString line, Feedback& feedback)
 /* Routine to read in a line from the enviroment file and hand that line
  line to the approprate routine to process it.                         */
 {
+  m_fingerprint.Add(line);
+
   cString type = line.PopWord();      // Determine type of this entry.
   type.ToUpper();                     // Make type case insensitive.
 
@@ -1263,9 +1267,33 @@ bool cEnvironment::LoadLine(cString line, Feedback& feedback)
     return false;
   }
 
+  if (type == "REACTION") BuildReactionPlan();
+
   return true;
 }
 
+
+void cEnvironment::BuildReactionPlan()
+{
+  const int num_reactions = reaction_lib.GetSize();
+  m_reaction_plan.Resize(num_reactions);
+  for (int i = 0; i < num_reactions; i++) {
+    sReactionPlan& plan = m_reaction_plan[i];
+    plan.reaction = reaction_lib.GetReaction(i);
+    plan.task = plan.reaction->GetTask();
+    plan.has_requisites = (plan.reaction->GetRequisites().GetSize() > 0);
+    plan.has_context_requisites = (plan.reaction->GetContextRequisites().GetSize() > 0);
+
+    // Only processes with a phenotypic plasticity bonus method need the (expensive) task probability
+    plan.test_plasticity = false;
+    tLWConstListIterator<cReactionProcess> proc_it(plan.reaction->GetProcesses());
+    const cReactionProcess* cur_proc;
+    while ((cur_proc = proc_it.Next()) != NULL) {
+      if (cur_proc->GetPhenPlastBonusMethod() != DEFAULT) plan.test_plasticity = true;
+    }
+  }
+}
+
 bool cEnvironment::Load(const cString& filename, const cString& working_dir, Feedback& feedback)
 {
   cInitFile infile(filename, working_dir);
@@ -1305,6 +1333,23 @@ bool cEnvironment::Load(const cString& filename, const cString& working_dir, Fee
 }
 
 
+void cEnvironment::SetSpecificInputs(const tArray<int> in_input_array)
+{
+  m_fingerprint.Add(cString("SetSpecificInputs"));
+  for (int i = 0; i < in_input_array.GetSize(); i++) m_fingerprint.Add(in_input_array[i]);
+
+  m_use_specific_inputs = true;
+  m_specific_inputs = in_input_array;
+}
+
+void cEnvironment::SetSpecificRandomMask(unsigned int mask)
+{
+  m_fingerprint.Add(cString("SetSpecificRandomMask"));
+  m_fingerprint.Add(static_cast<int>(mask));
+
+  m_mask = mask;
+}
+
 void cEnvironment::SetupInputs(cAvidaContext& ctx, tArray<int>& input_array, bool random) const
 {
   input_array.Resize(m_input_size);
@@ -1369,10 +1414,10 @@ bool cEnvironment::TestInput(cReactionResult& result, const tBuffer<int>& inputs
 
 
 bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
-                              cTaskContext& taskctx, const tArray<int>& task_count,
-                              tArray<int>& reaction_count,
+                              cTaskContext& taskctx, const tArraySlice<int>& task_count,
+                              tArraySlice<int>& reaction_count,
                               const tArray<double>& resource_count,
-                              const tArray<double>& rbins_count,
+                              const tArraySlice<double>& rbins_count,
                               bool is_parasite, cContextPhenotype* context_phenotype) const
 {
   //flag to skip processing of parasite tasks
@@ -1384,50 +1429,39 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
   // Do setup for reaction tests...
   m_tasklib.SetupTests(taskctx);
 
+  const bool on_divide = taskctx.GetOnDivide();
+  
   // Loop through all reactions to see if any have been triggered...
-  const int num_reactions = reaction_lib.GetSize();
+  const int num_reactions = m_reaction_plan.GetSize();
+  assert(num_reactions == reaction_lib.GetSize());
   for (int i = 0; i < num_reactions; i++) {
-    cReaction* cur_reaction = reaction_lib.GetReaction(i);
+    const sReactionPlan& plan = m_reaction_plan[i];
+    cReaction* cur_reaction = plan.reaction;
     assert(cur_reaction != NULL);
 
     // Only use active reactions...
     if (cur_reaction->GetActive() == false) continue;
 
     // Examine the task trigger associated with this reaction
-    cTaskEntry* cur_task = cur_reaction->GetTask();
+    cTaskEntry* cur_task = plan.task;
     assert(cur_task != NULL);
 
     taskctx.SetTaskEntry(cur_task); // Set task entry in the context, so that tasks can reference task settings
     const int task_id = cur_task->GetID();
     const int task_cnt = task_count[task_id];
-    const bool on_divide = taskctx.GetOnDivide();
 
-    // Examine requisites on this reaction
-    if (TestRequisites(taskctx, cur_reaction, task_cnt, reaction_count, on_divide) == false) { 
-      if (!skipProcessing){
-        continue;
-      }
-    }
+    // Examine requisites on this reaction (with none, only IO checks pass)
+    const bool requisites_met = plan.has_requisites ?
+      TestRequisites(taskctx, cur_reaction, task_cnt, reaction_count, on_divide) : !on_divide;
+    if (!requisites_met && !skipProcessing) continue;
 
     if (context_phenotype != 0) {
-      tArray<int> blank_tasks;
-      tArray<int> blank_reactions;
-      blank_tasks.ResizeClear(task_count.GetSize());
-      for(int count=0;count<task_count.GetSize();count++) {
-        blank_tasks[count] = 0;
-      }
-      blank_reactions.ResizeClear(this->GetReactionLib().GetSize());
-      for(int count=0;count<reaction_count.GetSize();count++) {
-        blank_reactions[count] = 0;
-      }
-      context_phenotype->AddTaskCounts(blank_tasks.GetSize(), blank_tasks);
-      context_phenotype->AddReactionCounts(blank_reactions.GetSize(), blank_reactions);
+      context_phenotype->ResizeCounts(task_count.GetSize(), num_reactions);
       int context_task_count = context_phenotype->GetTaskCounts()[task_id];
-      if (TestContextRequisites(cur_reaction, context_task_count, context_phenotype->GetReactionCounts(), on_divide) == false) {
-        if (!skipProcessing) {  // for those parasites again
-          continue;
-        }
-      }
+      const bool context_met = plan.has_context_requisites ?
+        TestContextRequisites(cur_reaction, context_task_count, context_phenotype->GetReactionCounts(), on_divide) :
+        !on_divide;
+      if (!context_met && !skipProcessing) continue;  // for those parasites again
     }
 
     const double task_quality = m_tasklib.TestOutput(taskctx);
@@ -1438,7 +1472,10 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
     // @MRR task_probability will be either the probability [0,1] for the task or it will
     // be -1.0 if the value is not needed for this reaction.
     bool force_mark_task = false; //@MRR Some phenplastbonus settings will force a task to be counted even if it isn't demonstrated.
-    double task_probability = GetTaskProbability(ctx, taskctx, cur_reaction->GetProcesses(), force_mark_task);
+    double task_probability = -1.0;
+    if (plan.test_plasticity) {
+      task_probability = GetTaskProbability(ctx, taskctx, cur_reaction->GetProcesses(), force_mark_task);
+    }
 
     if (task_quality == 0.0 && !force_mark_task) continue;
 
@@ -1463,7 +1500,7 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
 }
 
 bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_reaction,
-                                  int task_count, const tArray<int>& reaction_count, const bool on_divide) const
+                                  int task_count, const tArraySlice<int>& reaction_count, const bool on_divide) const
 {
   const tList<cReactionRequisite>& req_list = cur_reaction->GetRequisites();
   const int num_reqs = req_list.GetSize();
@@ -1483,7 +1520,7 @@ bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_re
     
     if (taskctx.GetOrganism()) {
       // Have all reactions been met?
-      const tArray<int> stolen_reactions = taskctx.GetOrganism()->GetPhenotype().GetStolenReactionCount(); 
+      const tArraySlice<int>& stolen_reactions = taskctx.GetOrganism()->GetPhenotype().GetStolenReactionCount();
       tLWConstListIterator<cReaction> reaction_it(cur_req->GetReactions());
       while (reaction_it.Next() != NULL) {
         int react_id = reaction_it.Get()->GetID();
@@ -1526,13 +1563,15 @@ bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_re
     if (reaction_count[cur_reaction->GetID()] < cur_req->GetMinReactionCount()) continue;
     if (reaction_count[cur_reaction->GetID()] >= cur_req->GetMaxReactionCount()) continue;
     
-    // Have all total reaction counts been met?
-    int tot_reactions = 0;
-    for (int i=0; i<reaction_count.GetSize(); i++) {
-      tot_reactions += reaction_count[i];
+    // Have all total reaction counts been met? (only summed when the requisite actually bounds the total)
+    if (cur_req->GetMinTotReactionCount() > 0 || cur_req->GetMaxTotReactionCount() < INT_MAX) {
+      int tot_reactions = 0;
+      for (int i=0; i<reaction_count.GetSize(); i++) {
+        tot_reactions += reaction_count[i];
+      }
+      if (tot_reactions < cur_req->GetMinTotReactionCount()) continue;
+      if (tot_reactions >= cur_req->GetMaxTotReactionCount()) continue;
     }
-    if (tot_reactions < cur_req->GetMinTotReactionCount()) continue;
-    if (tot_reactions >= cur_req->GetMaxTotReactionCount()) continue;
     
 
     // Have divide task reqs been met?
@@ -1599,13 +1638,15 @@ bool cEnvironment::TestContextRequisites(const cReaction* cur_reaction,
     if (reaction_count[cur_reaction->GetID()] < cur_req->GetMinReactionCount()) continue;
     if (reaction_count[cur_reaction->GetID()] >= cur_req->GetMaxReactionCount()) continue;
     
-    // Have all total reaction counts been met?
-    int tot_reactions = 0;
-    for (int i=0; i<reaction_count.GetSize(); i++) {
-      tot_reactions += reaction_count[i];
+    // Have all total reaction counts been met? (only summed when the requisite actually bounds the total)
+    if (cur_req->GetMinTotReactionCount() > 0 || cur_req->GetMaxTotReactionCount() < INT_MAX) {
+      int tot_reactions = 0;
+      for (int i=0; i<reaction_count.GetSize(); i++) {
+        tot_reactions += reaction_count[i];
+      }
+      if (tot_reactions < cur_req->GetMinTotReactionCount()) continue;
+      if (tot_reactions >= cur_req->GetMaxTotReactionCount()) continue;
     }
-    if (tot_reactions < cur_req->GetMinTotReactionCount()) continue;
-    if (tot_reactions >= cur_req->GetMaxTotReactionCount()) continue;
     
     // Have divide task reqs been met?
     // If div_type is 0 we only check on IO, if 1 we only check on divide,
@@ -1654,7 +1695,7 @@ double cEnvironment::GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskct
 
 
 void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list,
-                               const tArray<double>& resource_count, const tArray<double>& rbins_count,
+                               const tArray<double>& resource_count, const tArraySlice<double>& rbins_count,
                                const double task_quality, const double task_probability, const int task_count,
                                const int reaction_id, cReactionResult& result, cTaskContext& taskctx) const
 {
@@ -1912,6 +1953,10 @@ double cEnvironment::GetReactionValue(int reaction_id)
 
 bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, double value)
 {
+  m_fingerprint.Add(cString("SetReactionValue"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(value);
+
   const int num_reactions = reaction_lib.GetSize();
 
   // See if this should be applied to all reactions.
@@ -1938,6 +1983,7 @@ bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, dou
 
     // And set them...
     for (int i = 0; i < num_set; i++) {
+      m_fingerprint.Add(reaction_ids[i]);
       cReaction* cur_reaction = reaction_lib.GetReaction(reaction_ids[i]);
       assert(cur_reaction != NULL);
       cur_reaction->ModifyValue(value);
@@ -1953,6 +1999,10 @@ bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, dou
 
 bool cEnvironment::SetReactionValueMult(const cString& name, double value_mult)
 {
+  m_fingerprint.Add(cString("SetReactionValueMult"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(value_mult);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   found_reaction->MultiplyValue(value_mult);
@@ -1961,6 +2011,10 @@ bool cEnvironment::SetReactionValueMult(const cString& name, double value_mult)
 
 bool cEnvironment::SetReactionInst(const cString& name, cString inst_name)
 {
+  m_fingerprint.Add(cString("SetReactionInst"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(inst_name);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   found_reaction->ModifyInst(inst_name);
@@ -1969,6 +2023,10 @@ bool cEnvironment::SetReactionInst(const cString& name, cString inst_name)
 
 bool cEnvironment::SetReactionMinTaskCount(const cString& name, int min_count)
 {
+  m_fingerprint.Add(cString("SetReactionMinTaskCount"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(min_count);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   return found_reaction->SetMinTaskCount( min_count );
@@ -1976,6 +2034,10 @@ bool cEnvironment::SetReactionMinTaskCount(const cString& name, int min_count)
 
 bool cEnvironment::SetReactionMaxTaskCount(const cString& name, int max_count)
 {
+  m_fingerprint.Add(cString("SetReactionMaxTaskCount"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(max_count);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   return found_reaction->SetMaxTaskCount( max_count );
@@ -1983,6 +2045,10 @@ bool cEnvironment::SetReactionMaxTaskCount(const cString& name, int max_count)
 
 bool cEnvironment::SetReactionMinCount(const cString& name, int reaction_min_count)
 {
+  m_fingerprint.Add(cString("SetReactionMinCount"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(reaction_min_count);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   return found_reaction->SetMinReactionCount( reaction_min_count );
@@ -1990,6 +2056,10 @@ bool cEnvironment::SetReactionMinCount(const cString& name, int reaction_min_cou
 
 bool cEnvironment::SetReactionMaxCount(const cString& name, int reaction_max_count)
 {
+  m_fingerprint.Add(cString("SetReactionMaxCount"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(reaction_max_count);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   return found_reaction->SetMaxReactionCount( reaction_max_count );
@@ -1997,6 +2067,10 @@ bool cEnvironment::SetReactionMaxCount(const cString& name, int reaction_max_cou
 
 bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
 {
+  m_fingerprint.Add(cString("SetReactionTask"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(task);
+
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
 
@@ -2005,6 +2079,7 @@ bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
     if (m_tasklib.GetTask(i).GetName() == task)
     {
       found_reaction->SetTask( m_tasklib.GetTaskReference(i) );
+      BuildReactionPlan();
       return true;
     }
   }
@@ -2014,6 +2089,10 @@ bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
 
 bool cEnvironment::SetResourceInflow(const cString& name, double _inflow )
 {
+  m_fingerprint.Add(cString("SetResourceInflow"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(_inflow);
+
   cResource* found_resource = resource_lib.GetResource(name);
   if (found_resource == NULL) return false;
   found_resource->SetInflow( _inflow );
@@ -2022,6 +2101,10 @@ bool cEnvironment::SetResourceInflow(const cString& name, double _inflow )
 
 bool cEnvironment::SetResourceOutflow(const cString& name, double _outflow )
 {
+  m_fingerprint.Add(cString("SetResourceOutflow"));
+  m_fingerprint.Add(name);
+  m_fingerprint.Add(_outflow);
+
   cResource* found_resource = resource_lib.GetResource(name);
   if (found_resource == NULL) return false;
   found_resource->SetOutflow( _outflow );
@@ -26,11 +26,14 @@
 #ifndef cEnvironment_h
 #define cEnvironment_h
 
+#include "cFingerprint.h"
 #include "cMutationRates.h"
 #include "cReactionLib.h"
 #include "cResourceLib.h"
 #include "cString.h"
 #include "cTaskLib.h"
+#include "tArray.h"
+#include "tArraySlice.h"
 #include "tList.h"
 
 #include <set>
@@ -48,8 +51,8 @@ class cReactionProcess;
 class cReactionResult;
 class cStateGrid;
 class cTaskContext;
+class cTaskEntry;
 class cWorld;
-template <class T> class tArray;
 template <class T> class tBuffer;
 
 using namespace Avida;
@@ -80,6 +83,22 @@ private:
   std::set<int> possible_target_ids;
   std::set<int> possible_habitats;
 
+  // Per-reaction evaluation plan, rebuilt whenever the reaction set changes so that TestOutput can skip the checks a
+  // reaction cannot need
+  struct sReactionPlan
+  {
+    cReaction* reaction;
+    cTaskEntry* task;
+    bool has_requisites;
+    bool has_context_requisites;
+    bool test_plasticity;
+  };
+  tArray<sReactionPlan> m_reaction_plan;
+
+  // Hash of every line loaded and every change made through the mutators below, identifying the environment that
+  // test CPU results were found in
+  cFingerprint m_fingerprint;
+
   
   cEnvironment(); // @not_implemented
   cEnvironment(const cEnvironment&); // @not_implemented
@@ -94,8 +113,8 @@ public:
 
   // Interaction with the organisms
   void SetupInputs(cAvidaContext& ctx, tArray<int>& input_array, bool random = true) const;
-  void SetSpecificInputs(const tArray<int> in_input_array) { m_use_specific_inputs = true; m_specific_inputs = in_input_array; }
-  void SetSpecificRandomMask(unsigned int mask) { m_mask = mask; }
+  void SetSpecificInputs(const tArray<int> in_input_array);
+  void SetSpecificRandomMask(unsigned int mask);
   void SwapInputs(cAvidaContext& ctx, tArray<int>& src_input_array, tArray<int>& dest_input_array) const;
 
 
@@ -103,8 +122,8 @@ public:
                  const tBuffer<int>& outputs, const tArray<double>& resource_count) const;
 
   bool TestOutput(cAvidaContext& ctx, cReactionResult& result, cTaskContext& taskctx,
-                  const tArray<int>& task_count, tArray<int>& reaction_count,
-                  const tArray<double>& resource_count, const tArray<double>& rbins_count,
+                  const tArraySlice<int>& task_count, tArraySlice<int>& reaction_count,
+                  const tArray<double>& resource_count, const tArraySlice<double>& rbins_count,
                   bool is_parasite=false, cContextPhenotype* context_phenotype = 0) const;
 
   // Accessors
@@ -130,6 +149,7 @@ public:
   const cStateGrid& GetStateGrid(int sg) const { return *m_state_grids[sg]; }  
 
   int GetInputSize()  const { return m_input_size; };
+  unsigned long long GetFingerprint() const { return m_fingerprint.GetValue(); }
   int GetOutputSize() const { return m_output_size; };
 
   const cString& GetReactionName(int reaction_id) const;
@@ -176,16 +196,18 @@ private:
   
   bool LoadDynamicResource(cString desc, Feedback& feedback);
   bool LoadGradientResource(cString desc, Feedback& feedback);
+  void BuildReactionPlan();
+
   double GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskctx,
 
                             const tList<cReactionProcess>& req_proc, bool& force_mark_task) const;
   
   bool TestRequisites(cTaskContext& taskctx, const cReaction* cur_reaction, int task_count,
-                      const tArray<int>& reaction_count, const bool on_divide = false) const; 
+                      const tArraySlice<int>& reaction_count, const bool on_divide = false) const; 
   bool TestContextRequisites(const cReaction* cur_reaction, int task_count, 
                       const tArray<int>& reaction_count, const bool on_divide = false) const;
   void DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list, 
-                   const tArray<double>& resource_count, const tArray<double>& rbin_count,
+                   const tArray<double>& resource_count, const tArraySlice<double>& rbin_count,
                    const double task_quality, const double task_probability,
                    const int task_count, const int reaction_id, 
                    cReactionResult& result, cTaskContext& taskctx) const;
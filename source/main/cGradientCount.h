@@ -123,6 +123,8 @@ public:
 
   void UpdateCount(cAvidaContext& ctx);
   void StateAll();
+  // UpdateCount draws from the world RNG and may act on the population (predatory resources)
+  bool UpdatesIndependently() const { return false; }
   
   void SetGradInitialPlat(double plat_val) { m_initial_plat = plat_val; m_initial = true; }
   void SetGradPeakX(int peakx) { m_peakx = peakx; }
@@ -30,6 +30,8 @@
 #if BOOST_IS_AVAILABLE
 #include "avida/core/Sequence.h"
 
+#include "cHardwareManager.h"
+#include "cInstSet.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cMerit.h"
@@ -43,7 +45,8 @@
 #include <iostream>
 #include <sstream>
 #include <cmath>
-#include <boost/optional.hpp>
+#include <cstring>
+#include <algorithm>
 
 using namespace Avida;
 
@@ -52,40 +55,80 @@ using namespace Avida;
 static const char* UPDATE="mean update time [ut]";
 static const char* POSTUPDATE="mean post-update time [post]";
 static const char* CALCUPDATE="mean calc-update time [calc]";
+static const char* MIGRATION="mean migration throughput [migrants/s]";
 
-/*! Message that is sent from one cMultiProcessWorld to another during organism
- migration.
+// migration messages are tagged with the update they were sent in, modulo this range (the smallest MPI_TAG_UB allowed).
+// with a lag of L, worlds are at most L+1 updates apart, so at most 2L+2 different updates are ever in flight.
+static const int MIGRATION_TAG_RANGE=32768;
+
+/*! Organism that migrates from one cMultiProcessWorld to another.
+ 
+ Migrants sent from one world to another during an update are packed back to back
+ into a single binary message.  Each migrant is a fixed-size record followed by its
+ instruction opcodes, one byte each.  Records are in host byte order, as all the
+ processes of an Avida-MP run are expected to share one architecture.
  */
 struct migration_message {
+	//! Fixed-size part of a packed migrant.
+	struct record {
+		double merit; //!< Merit of this organism in its originating population.
+		int lineage; //!< Lineage label of this organism in its orginating population.
+		int x; //!< X-coordinate of the cell from which this migrant originated.
+		int y; //!< Y-coordinate of the cell from which this migrant originated.
+		int generation; //!< Generation of this organism.
+		int hw_type; //!< Hardware type of the genome.
+		int inst_set; //!< Instruction set of the genome (see cHardwareManager::GetInstSetID).
+		int length; //!< Number of instructions that follow this record.
+	};
+	
 	//! Default constructor.
 	migration_message() { }
 	
-	//! Initializing constructor.
-	migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage)
-	: _merit(merit), _lineage(lineage) {
-		_genome = org->GetGenome().AsString();
-		cell.GetPosition(_x, _y);
-		_generation = org->GetPhenotype().GetGeneration();
+	//! Append a migrant to a message.
+	static void pack(std::vector<char>& buf, cOrganism* org, const cPopulationCell& cell, double merit, int lineage, int inst_set) {
+		const Genome& genome = org->GetGenome();
+		const Sequence& seq = genome.GetSequence();
+		
+		record r;
+		r.merit = merit;
+		r.lineage = lineage;
+		cell.GetPosition(r.x, r.y);
+		r.generation = org->GetPhenotype().GetGeneration();
+		r.hw_type = genome.GetHardwareType();
+		r.inst_set = inst_set;
+		r.length = seq.GetSize();
+		
+		const std::size_t offset = buf.size();
+		buf.resize(offset + sizeof(record) + r.length);
+		char* p = &buf[offset];
+		std::memcpy(p, &r, sizeof(record));
+		p += sizeof(record);
+		for(int i=0; i<r.length; ++i) {
+			p[i] = static_cast<char>(seq[i].GetOp());
+		}
 	}
-
+	
+	//! Unpack the migrant at p, returning the start of the next one.
+	const char* unpack(const char* p, const cHardwareManager& hwm) {
+		std::memcpy(&_rec, p, sizeof(record));
+		p += sizeof(record);
+		
+		Sequence seq(_rec.length);
+		for(int i=0; i<_rec.length; ++i) {
+			seq[i].SetOp(static_cast<unsigned char>(p[i]));
+		}
+		_genome = Genome(_rec.hw_type, (_rec.inst_set < 0) ? cString("(default)") : hwm.GetInstSet(_rec.inst_set).GetInstSetName(), seq);
+		return p + _rec.length;
+	}
+	
 	//! Finish unpacking an organism from this message.
 	void unpack(cOrganism* org) {
-		org->UpdateMerit(_merit);
-		org->GetPhenotype().SetGeneration(_generation);
+		org->UpdateMerit(_rec.merit);
+		org->GetPhenotype().SetGeneration(_rec.generation);
 	}	
 	
-	//! Serializer, used to (de)marshal organisms for migration.
-	template<class Archive>
-	void serialize(Archive & ar, const unsigned int version) {
-		ar & _genome & _merit & _lineage & _x & _y & _generation;
-	}
-	
-	std::string _genome; //!< Genome of the migrating organism.
-	double _merit; //!< Merit of this organism in its originating population.
-	int _lineage; //!< Lineage label of this organism in its orginating population.
-	int _x; //!< X-coordinate of the cell from which this migrant originated.
-	int _y; //!< Y-coordinate of the cell from which this migrant originated.
-	int _generation; //!< Generation of this organism.
+	record _rec; //!< Everything but the genome's instructions.
+	Genome _genome; //!< Genome of the migrating organism.
 };
 
 
@@ -114,7 +157,22 @@ cMultiProcessWorld::cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, bo
 , m_universe_dim(0)
 , m_universe_x(0)
 , m_universe_y(0)
-, m_universe_popsize(-1) {
+, m_migrants(0)
+, m_last_inst_set_id(-1)
+, m_universe_popsize(-1)
+, m_universe_merit(0.0)
+, m_reduced_update(-1)
+, m_reduce_req(MPI_REQUEST_NULL) {
+	m_outbox.resize(m_mpi_world.size());
+	m_send_counts.resize(m_mpi_world.size(), 0);
+	
+	if(GetConfig().MP_MIGRATION_STYLE.Get() == MP_MIGRATION_ASYNC) {
+		const int lag = GetConfig().MP_MIGRATION_LAG.Get();
+		if((lag < 0) || ((2*lag + 2) > MIGRATION_TAG_RANGE)) {
+			GetDriver().RaiseFatalException(-1, "MP_MIGRATION_LAG must be between 0 and 16383.");
+		}
+	}
+	
 	if(GetConfig().BIRTH_METHOD.Get() == POSITION_OFFSPRING_RANDOM) {
 		// there are a couple bugs in spatial that still need to be worked out:
 		// specifically, what to do about size(1) universes?
@@ -184,9 +242,16 @@ void cMultiProcessWorld::MigrateOrganism(cOrganism* org, const cPopulationCell&
 	assert(dst_world < m_mpi_world.size());
 	assert(dst_world >= 0);
 
-	// the tag is set to the number of messages previously sent; this is to allow
-	// the receiver to sort messages for consistency.
-	m_reqs.push_back(m_mpi_world.isend(dst_world, m_reqs.size(), migration_message(org, cell, merit.GetDouble(), lineage)));
+	// the migrant is packed into this update's message to its destination, which is
+	// sent by ProcessPostUpdate.  almost all migrants share an instruction set, so
+	// the last lookup is reused:
+	const cString& inst_set = org->GetGenome().GetInstSet();
+	if(inst_set != m_last_inst_set) {
+		m_last_inst_set = inst_set;
+		m_last_inst_set_id = GetHardwareManager().GetInstSetID(inst_set);
+	}
+	migration_message::pack(m_outbox[dst_world], org, cell, merit.GetDouble(), lineage, m_last_inst_set_id);
+	++m_migrants;
 	
 	// stats tracking:
 	GetStats().OutgoingMigrant(org);
@@ -213,7 +278,7 @@ bool cMultiProcessWorld::TestForMigration() {
 			if(m_mpi_world.size() == 1) {
 				return true; // 1 world == always migrate
 			}
-			return GetRandom().P((m_mpi_world.size() - 1) / m_mpi_world.size());
+			return GetRandom().P(static_cast<double>(m_mpi_world.size() - 1) / m_mpi_world.size());
 		}
 		default: {
 			// default is to not migrate!
@@ -265,94 +330,224 @@ bool cMultiProcessWorld::IsWorldBoundary(const cPopulationCell& cell) {
  
  Migrants are injected according to BIRTH_METHOD.
  
- \todo What to do about cross-world lineage labels?
+ With MP_MIGRATION_STYLE=0, all worlds synchronize on every update boundary.  With
+ MP_MIGRATION_STYLE=1, migrants are delivered MP_MIGRATION_LAG updates after they
+ were sent, and a world only waits when another world falls more than that many
+ updates behind.
  
- \todo At the moment, this method forces synchronization on update boundaries across
- *all* worlds.  This could slow things down quite a bit, so we may need to consider a
- second mode that relaxes consistency in favor of speed.
+ \todo What to do about cross-world lineage labels?
  */
 void cMultiProcessWorld::ProcessPostUpdate(cAvidaContext& ctx) {
-	namespace mpi = boost::mpi;
-	using namespace boost;
-	
 	// restart the timer for this method, and get the elapsed time for the past update:
 	m_pf[UPDATE] = m_update_timer.elapsed();
 	m_post_update_timer.restart();
 	
-	// wait until we're sure that this process has sent all its messages:
-	mpi::wait_all(m_reqs.begin(), m_reqs.end());
-	m_reqs.clear();
+	if(GetConfig().MP_MIGRATION_STYLE.Get() == MP_MIGRATION_ASYNC) {
+		exchangeMigrantsAsync(ctx);
+	} else {
+		exchangeMigrantsSync(ctx);
+	}
+
+	// record profiling stats:
+	m_pf[POSTUPDATE] = m_post_update_timer.elapsed();
+	if((m_migrants > 0) && (m_pf[POSTUPDATE] > 0.0)) {
+		m_pf[MIGRATION] = m_migrants / m_pf[POSTUPDATE];
+	}
+	m_migrants = 0;
+	GetStats().ProfilingData(m_pf);
+	m_pf.clear();
+	
+	// restart the update timer!
+	m_update_timer.restart();
+}
+
+
+/*! Inject a migrant into the local population.
+ */
+void cMultiProcessWorld::injectMigrant(migration_message& migrant, cAvidaContext& ctx) {
+	int target_cell=-1;
+	
+	switch(GetConfig().BIRTH_METHOD.Get()) {
+		case POSITION_OFFSPRING_RANDOM: { // spatial
+			// invert the orginating cell
+			migrant._rec.x = GetConfig().WORLD_X.Get() - migrant._rec.x - 1;
+			migrant._rec.y = GetConfig().WORLD_Y.Get() - migrant._rec.y - 1;
+			target_cell = GetConfig().WORLD_Y.Get() * migrant._rec.y + migrant._rec.x;
+			break;
+		}
+		case POSITION_OFFSPRING_FULL_SOUP_RANDOM: { // mass action
+			target_cell = GetRandom().GetInt(GetPopulation().GetSize());
+			break;
+		}
+		default: {
+			GetDriver().RaiseFatalException(-1, "Avida-MP only supports BIRTH_METHODS 0 (POSITION_OFFSPRING_RANDOM) and 4 (POSITION_OFFSPRING_FULL_SOUP_RANDOM).");
+		}
+	}
+	
+	GetPopulation().InjectGenome(target_cell,
+															 SRC_ORGANISM_RANDOM, // for right now, we'll treat this as a random organism injection
+															 migrant._genome, // genome unpacked from message
+															 ctx, migrant._rec.lineage); // lineage label
+	// unpack the rest from the message:
+	migrant.unpack(GetPopulation().GetCell(target_cell).GetOrganism());
+	GetStats().IncomingMigrant(GetPopulation().GetCell(target_cell).GetOrganism());
+}
+
+
+/*! Send the migrants packed during this update, one message per destination world.
+ */
+void cMultiProcessWorld::sendMigrants() {
+	const int tag = GetStats().GetUpdate() % MIGRATION_TAG_RANGE;
+	for(int dst=0; dst<m_mpi_world.size(); ++dst) {
+		if(m_outbox[dst].empty()) {
+			continue;
+		}
+		m_send_bufs.push_back(migrant_buffer());
+		migrant_buffer& buf = m_send_bufs.back();
+		buf.swap(m_outbox[dst]);
+		m_reqs.push_back(m_mpi_world.isend(dst, tag, &buf[0], static_cast<int>(buf.size())));
+		m_send_counts[dst] = 1;
+	}
+}
+
+
+/*! Receive the message described by s.
+ */
+void cMultiProcessWorld::receiveMigrants(const boost::mpi::status& s, migrant_buffer& buf) {
+	buf.resize(s.count<char>().get());
+	m_mpi_world.recv(s.source(), s.tag(), &buf[0], static_cast<int>(buf.size()));
+}
+
+
+/*! Inject all migrants in a message into the local population, in the order they were sent.
+ */
+void cMultiProcessWorld::injectMigrants(const migrant_buffer& buf, cAvidaContext& ctx) {
+	const char* p = &buf[0];
+	const char* end = p + buf.size();
+	while(p < end) {
+		migration_message migrant;
+		p = migrant.unpack(p, GetHardwareManager());
+		injectMigrant(migrant, ctx);
+		++m_migrants;
+	}
+}
+
+
+/*! Exchange migrants synchronously.
+ 
+ Every world finds out how many messages it receives with a blocking reduce-scatter of
+ the per-destination message counts, so the slowest world sets the pace of all worlds on
+ every update.  Messages are received before this world waits for its own sends, as
+ large messages are not sent until they are being received.
+ */
+void cMultiProcessWorld::exchangeMigrantsSync(cAvidaContext& ctx) {
+	namespace mpi = boost::mpi;
 	
-	// at this point, we know that *this* process has sent everything.  but, we don't
-	// know if it's *received* everything.  so, we're going to put in a synchronization
-	// barrier, which means that every process must reach the barrier before any are allowed
-	// to proceed.  since we just finished waiting for all communication to complete,
-	// this means that all messages must have been received, too.
-	m_mpi_world.barrier();	
+	sendMigrants();
+	int recv_count=0;
+	MPI_Reduce_scatter_block(&m_send_counts[0], &recv_count, 1, MPI_INT, MPI_SUM, m_mpi_world);
 	
-	// now, receive all the messages, but store them in order by source and tag:
-	typedef std::map<int,migration_message> rx_tag_t;
-	typedef std::map<int,rx_tag_t> rx_src_t;
+	// receive all the messages, but store them in order by source (each source sends
+	// at most one message per update):
+	typedef std::map<int,migrant_buffer> rx_src_t;
 	rx_src_t recvd;
-	optional<mpi::status> s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);
-	while(s.is_initialized()) {
-		migration_message msg;
-		m_mpi_world.recv(s->source(), s->tag(), msg);
-		recvd[s->source()][s->tag()] = msg;		
-		// any others?
-		s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);		
+	const int tag = GetStats().GetUpdate() % MIGRATION_TAG_RANGE;
+	for(int i=0; i<recv_count; ++i) {
+		mpi::status s = m_mpi_world.probe(mpi::any_source, tag);
+		receiveMigrants(s, recvd[s.source()]);
 	}
 	
 	// iterate over received messages in-order, injecting genomes into our population:
 	for(rx_src_t::iterator i=recvd.begin(); i!=recvd.end(); ++i) {
-		for(rx_tag_t::iterator j=i->second.begin(); j!=i->second.end(); ++j) {
-			//std::cerr << "**********  INJECTING *********** " << i->first << " " << j->first << std::endl;
-			// ok, add this migrant to the current population
-			migration_message& migrant = j->second;
-			int target_cell=-1;
-			
-			switch(GetConfig().BIRTH_METHOD.Get()) {
-				case POSITION_OFFSPRING_RANDOM: { // spatial
-					// invert the orginating cell
-					migrant._x = GetConfig().WORLD_X.Get() - migrant._x - 1;
-					migrant._y = GetConfig().WORLD_Y.Get() - migrant._y - 1;
-					target_cell = GetConfig().WORLD_Y.Get() * migrant._y + migrant._x;
-					break;
-				}
-				case POSITION_OFFSPRING_FULL_SOUP_RANDOM: { // mass action
-					target_cell = GetRandom().GetInt(GetPopulation().GetSize());
-					break;
-				}
-				default: {
-					GetDriver().RaiseFatalException(-1, "Avida-MP only supports BIRTH_METHODS 0 (POSITION_OFFSPRING_RANDOM) and 4 (POSITION_OFFSPRING_FULL_SOUP_RANDOM).");
-				}
-			}
-			
-			GetPopulation().InjectGenome(target_cell,
-																	 SRC_ORGANISM_RANDOM, // for right now, we'll treat this as a random organism injection
-																	 Genome(cString(migrant._genome.c_str())), // genome unpacked from message
-																	 ctx, migrant._lineage); // lineage label
-			// unpack the rest from the message:
-			migrant.unpack(GetPopulation().GetCell(target_cell).GetOrganism());
-			GetStats().IncomingMigrant(GetPopulation().GetCell(target_cell).GetOrganism());
+		injectMigrants(i->second, ctx);
+	}
+	
+	// wait until we're sure that this process has sent all its messages:
+	mpi::wait_all(m_reqs.begin(), m_reqs.end());
+	m_reqs.clear();
+	m_send_bufs.clear();
+	std::fill(m_send_counts.begin(), m_send_counts.end(), 0);
+}
+
+
+/*! Exchange migrants asynchronously.
+ 
+ The messages sent during this update become a new epoch.  Each world learns how many
+ messages of that epoch it will receive through a non-blocking reduce-scatter of the
+ per-destination message counts, so no world ever waits for this update to finish elsewhere.
+ Epochs are delivered exactly MP_MIGRATION_LAG updates after they were sent; receiving
+ one can only block if some world has not yet finished the update it was sent in.
+ 
+ Since every epoch is delivered on a fixed update and in a fixed order, runs are
+ repeatable regardless of timing, and a lag of 0 reproduces synchronous migration.
+ */
+void cMultiProcessWorld::exchangeMigrantsAsync(cAvidaContext& ctx) {
+	const int update = GetStats().GetUpdate();
+	sendMigrants();
+	
+	// start counting this update's messages at their destinations.  references to
+	// elements of a deque remain valid as other elements are added and removed, so
+	// the epoch can hold the buffers of the reduction.
+	m_epochs.push_back(migration_epoch());
+	migration_epoch& epoch = m_epochs.back();
+	epoch.update = update;
+	epoch.recv_count = 0;
+	epoch.send_counts.swap(m_send_counts);
+	epoch.send_bufs.swap(m_send_bufs);
+	epoch.send_reqs.swap(m_reqs);
+	m_send_counts.assign(m_mpi_world.size(), 0);
+	MPI_Ireduce_scatter_block(&epoch.send_counts[0], &epoch.recv_count, 1, MPI_INT, MPI_SUM, m_mpi_world, &epoch.count_req);
+	
+	// deliver the migrants that were sent MP_MIGRATION_LAG updates ago:
+	const int lag = GetConfig().MP_MIGRATION_LAG.Get();
+	while(!m_epochs.empty() && (m_epochs.front().update <= (update - lag))) {
+		std::map<int,migrant_buffer> msgs;
+		receiveEpoch(msgs);
+		for(std::map<int,migrant_buffer>::iterator i=msgs.begin(); i!=msgs.end(); ++i) {
+			injectMigrants(i->second, ctx);
 		}
 	}
+}
+
+
+/*! Wait for the oldest migration epoch to complete, and receive its messages.
+ 
+ Each source sends at most one message per epoch, so ordering them by source gives an
+ order that does not depend on when they arrived.
+ */
+void cMultiProcessWorld::receiveEpoch(std::map<int,migrant_buffer>& msgs) {
+	namespace mpi = boost::mpi;
+	
+	migration_epoch& epoch = m_epochs.front();
+	MPI_Wait(&epoch.count_req, MPI_STATUS_IGNORE);
 	
-	// oh, sweet sanity; make sure that we actually processed all messages.
-	assert(!m_mpi_world.iprobe(mpi::any_source,mpi::any_tag).is_initialized());
+	const int tag = epoch.update % MIGRATION_TAG_RANGE;
+	for(int i=0; i<epoch.recv_count; ++i) {
+		mpi::status s = m_mpi_world.probe(mpi::any_source, tag);
+		receiveMigrants(s, msgs[s.source()]);
+	}
 	
-	// finally, we need another barrier down here, in the off chance that one of the
-	// processes is really speedy and manages to migrate another org to this world
-	// before we finished the probe-loop.
-	m_mpi_world.barrier();
+	// our own sends from that update are done with once they have been received:
+	mpi::wait_all(epoch.send_reqs.begin(), epoch.send_reqs.end());
+	m_epochs.pop_front();
+}
 
-	// record profiling stats:
-	m_pf[POSTUPDATE] = m_post_update_timer.elapsed();
-	GetStats().ProfilingData(m_pf);
-	m_pf.clear();
+
+/*! Complete all outstanding migration traffic.
+ 
+ With asynchronous migration, the migrants of the last MP_MIGRATION_LAG updates are
+ still in flight when the run ends.  They are received and discarded here, so that no
+ communication is pending when MPI is finalized.
+ */
+void cMultiProcessWorld::CompleteMigration() {
+	while(!m_epochs.empty()) {
+		std::map<int,migrant_buffer> msgs;
+		receiveEpoch(msgs);
+	}
 	
-	// restart the update timer!
-	m_update_timer.restart();
+	if(m_reduce_req != MPI_REQUEST_NULL) {
+		MPI_Wait(&m_reduce_req, MPI_STATUS_IGNORE);
+	}
 }
 
 
@@ -386,12 +581,7 @@ int cMultiProcessWorld::CalculateUpdateSize()
 			break;
 		}
 		case MP_SCHEDULING_INTEGRATED: { // MP aware
-			// sum the total number of organisms in all populations, storing that value
-			// so that we know if we have to exit early:
-			all_reduce(m_mpi_world, GetPopulation().GetNumOrganisms(), m_universe_popsize, std::plus<int>());
-			
-			// sum the merits of organisms in all populations.
-			// there's no clean way to do this across the different schedulers in avida,
+			// there's no clean way to sum merits across the different schedulers in avida,
 			// so we'll take the O(n) hit and sum them (for now):
 			double local_merit=0.0;
 			for(int i=0; i<GetPopulation().GetSize(); ++i) {
@@ -400,11 +590,12 @@ int cMultiProcessWorld::CalculateUpdateSize()
 					local_merit += cell.GetOrganism()->GetPhenotype().GetMerit().GetDouble();
 				}
 			}
-			double total_merit;
-			all_reduce(m_mpi_world, local_merit, total_merit, std::plus<double>());
+			
+			// sum the total number of organisms and merit in all populations:
+			reduceUniverse(local_merit);
 			
 			// ok, calculate the total CPU cycles allotted to this population:
-			update_size = (local_merit/total_merit) * GetConfig().AVE_TIME_SLICE.Get() * m_universe_popsize;
+			update_size = (local_merit/m_universe_merit) * GetConfig().AVE_TIME_SLICE.Get() * m_universe_popsize;
 			break;
 		}
 		default: {
@@ -416,4 +607,44 @@ int cMultiProcessWorld::CalculateUpdateSize()
 	return update_size;
 }
 
+/*! Update the universe population size and merit.
+ 
+ The population size is stored so that we know if we have to exit early.  Sums are
+ only taken every MP_REDUCTION_INTERVAL updates; in between, the last sums are reused.
+ With asynchronous migration the sum is gathered in the background, and is adopted at
+ the next reduction, one interval later.
+ */
+void cMultiProcessWorld::reduceUniverse(double local_merit) {
+	namespace mpi = boost::mpi;
+	
+	// the update size may be requested more than once per update (e.g., for status output):
+	const int update = GetStats().GetUpdate();
+	if(update == m_reduced_update) {
+		return;
+	}
+	const bool first = (m_reduced_update < 0);
+	m_reduced_update = update;
+	
+	const int interval = std::max(1, GetConfig().MP_REDUCTION_INTERVAL.Get());
+	if(!first && ((update % interval) != 0)) {
+		return;
+	}
+	
+	// the first sums are always taken right away, so that every world starts from the same totals:
+	if(first || (GetConfig().MP_MIGRATION_STYLE.Get() != MP_MIGRATION_ASYNC)) {
+		all_reduce(m_mpi_world, GetPopulation().GetNumOrganisms(), m_universe_popsize, std::plus<int>());
+		all_reduce(m_mpi_world, local_merit, m_universe_merit, std::plus<double>());
+		return;
+	}
+	
+	if(m_reduce_req != MPI_REQUEST_NULL) {
+		MPI_Wait(&m_reduce_req, MPI_STATUS_IGNORE);
+		m_universe_popsize = static_cast<int>(m_reduce_total[0]);
+		m_universe_merit = m_reduce_total[1];
+	}
+	m_reduce_local[0] = GetPopulation().GetNumOrganisms();
+	m_reduce_local[1] = local_merit;
+	MPI_Iallreduce(m_reduce_local, m_reduce_total, 2, MPI_DOUBLE, MPI_SUM, m_mpi_world, &m_reduce_req);
+}
+
 #endif // boost_is_available
@@ -26,12 +26,16 @@
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/timer.hpp>
+#include <deque>
+#include <map>
 #include <vector>
 
 #include "cWorld.h"
 #include "cAvidaConfig.h"
 #include "cStats.h"
 
+struct migration_message;
+
 /*! Multi-process Avida world.
  
  This class enables multi-process Avida, which provides a mechanism for much larger
@@ -48,13 +52,41 @@ class cMultiProcessWorld : public cWorld
 		cMultiProcessWorld& operator=(const cMultiProcessWorld&); // @not_implemented
 		
 	protected:
+		typedef std::vector<char> migrant_buffer; //!< Migrants packed into one message (see migration_message).
+		
+		/*! Migrants sent by this world during one update (asynchronous migration only).
+		 
+		 The number of messages each world receives is found with a non-blocking reduce-scatter
+		 over the per-destination message counts, started when the update ends.
+		 */
+		struct migration_epoch {
+			int update; //!< Update during which the migrants were sent.
+			std::vector<int> send_counts; //!< Number of messages sent to each world (0 or 1).
+			int recv_count; //!< Number of messages sent to this world, valid once count_req completes.
+			MPI_Request count_req; //!< Outstanding reduction of the send counts.
+			std::deque<migrant_buffer> send_bufs; //!< Messages being sent; a deque, so that they never move.
+			std::vector<boost::mpi::request> send_reqs; //!< Outstanding sends of the messages.
+		};
+		
 		boost::mpi::environment& m_mpi_env; //!< MPI environment.
 		boost::mpi::communicator& m_mpi_world; //!< World-wide MPI communicator.
-		std::vector<boost::mpi::request> m_reqs; //!< Requests outstanding since the last ProcessPostUpdate.
+		std::vector<migrant_buffer> m_outbox; //!< Migrants to each world since the last ProcessPostUpdate.
+		std::deque<migrant_buffer> m_send_bufs; //!< Messages sent by the current ProcessPostUpdate.
+		std::vector<boost::mpi::request> m_reqs; //!< Requests outstanding for m_send_bufs.
+		std::vector<int> m_send_counts; //!< Messages sent to each world by the current ProcessPostUpdate.
+		int m_migrants; //!< Migrants sent and received since the last ProcessPostUpdate.
+		cString m_last_inst_set; //!< Instruction set of the last migrant sent...
+		int m_last_inst_set_id; //!< ...and its index.
+		std::deque<migration_epoch> m_epochs; //!< Asynchronous migrations not yet delivered, oldest first.
 		int m_universe_dim; //!< Dimension (x & y) of the universe (number of worlds along the side of a grid of worlds).
 		int m_universe_x; //!< X coordinate of this world.
 		int m_universe_y; //!< Y coordinate of this world.
 		int m_universe_popsize; //!< Total size of the universe, delayed one update.
+		double m_universe_merit; //!< Total merit of the universe, as of the last reduction.
+		int m_reduced_update; //!< Update of the last call to reduceUniverse().
+		double m_reduce_local[2]; //!< Local population size and merit in the outstanding reduction.
+		double m_reduce_total[2]; //!< Universe population size and merit from the outstanding reduction.
+		MPI_Request m_reduce_req; //!< Outstanding background reduction (MPI_REQUEST_NULL if none).
 		
 		boost::timer m_update_timer; //!< Tracks the clock-time of updates.
 		boost::timer m_post_update_timer; //!< Tracks the clock-time of post-update processing.
@@ -63,6 +95,30 @@ class cMultiProcessWorld : public cWorld
 		
 		//! Constructor (prefer Initialize).
 		cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, boost::mpi::environment& env, boost::mpi::communicator& worldcomm);
+		
+		//! Send the migrants packed during this update, one message per destination world.
+		void sendMigrants();
+		
+		//! Receive the message described by s.
+		void receiveMigrants(const boost::mpi::status& s, migrant_buffer& buf);
+		
+		//! Inject all migrants in a message into the local population.
+		void injectMigrants(const migrant_buffer& buf, cAvidaContext& ctx);
+		
+		//! Inject a migrant into the local population.
+		void injectMigrant(migration_message& migrant, cAvidaContext& ctx);
+		
+		//! Exchange migrants synchronously, with all worlds in lockstep.
+		void exchangeMigrantsSync(cAvidaContext& ctx);
+		
+		//! Start delivery of this update's migrants, and deliver those sent MP_MIGRATION_LAG updates ago.
+		void exchangeMigrantsAsync(cAvidaContext& ctx);
+		
+		//! Wait for the oldest migration epoch to complete, and receive its messages by source.
+		void receiveEpoch(std::map<int, migrant_buffer>& msgs);
+		
+		//! Update the universe population size and merit, as often as MP_REDUCTION_INTERVAL allows.
+		void reduceUniverse(double local_merit);
 
 	public:
 		//! Create and initialize a cMultiProcessWorld.
@@ -71,6 +127,9 @@ class cMultiProcessWorld : public cWorld
 		//! Destructor.
 		virtual ~cMultiProcessWorld() { }
 		
+		//! Complete all outstanding migration traffic; must be called by every world before MPI is finalized.
+		void CompleteMigration();
+		
 		//! Migrate this organism to a different world.
 		virtual void MigrateOrganism(cOrganism* org, const cPopulationCell& cell,
 																 const cMerit& merit, int lineage);
@@ -0,0 +1,99 @@
+/*
+ *  cNeighborTable.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cNeighborTable.h"
+
+#include "cPopulationCell.h"
+
+
+void cCellConnections::insert(int idx, cPopulationCell* cell)
+{
+  assert(m_table != NULL);
+  if (m_size == m_table->m_stride) m_table->grow();
+
+  for (int i = m_size; i > idx; i--) m_row[i] = m_row[i - 1];
+  m_row[idx] = cell->GetID();
+  m_size++;
+}
+
+
+cPopulationCell* cCellConnections::FindPtr(const cPopulationCell* cell) const
+{
+  const int id = cell->GetID();
+  for (int i = 0; i < m_size; i++) if (m_row[i] == id) return &m_cells[id];
+  return NULL;
+}
+
+
+cPopulationCell* cCellConnections::Remove(cPopulationCell* cell)
+{
+  // Remove the first connection to cell, counting from the cell faced
+  const int id = cell->GetID();
+  for (int pos = 0; pos < m_size; pos++) {
+    int idx = m_facing + pos;
+    if (idx >= m_size) idx -= m_size;
+    if (m_row[idx] != id) continue;
+
+    for (int i = idx + 1; i < m_size; i++) m_row[i - 1] = m_row[i];
+    m_size--;
+
+    // The cell after the one removed takes its position
+    if (idx < m_facing) m_facing--;
+    if (m_facing == m_size) m_facing = 0;
+    return cell;
+  }
+  return NULL;
+}
+
+
+void cNeighborTable::Setup(tArray<cPopulationCell>& cells)
+{
+  m_cells = cells.begin();
+  m_num_cells = cells.GetSize();
+  m_stride = DEFAULT_STRIDE;
+  m_ids.ResizeClear(m_num_cells * m_stride);
+
+  for (int i = 0; i < m_num_cells; i++) {
+    cCellConnections& conn = m_cells[i].ConnectionList();
+    conn.m_table = this;
+    conn.m_cells = m_cells;
+    conn.m_row = m_ids.begin() + i * m_stride;
+    conn.m_size = 0;
+    conn.m_facing = 0;
+  }
+}
+
+
+void cNeighborTable::grow()
+{
+  const int new_stride = m_stride * 2;
+  tArray<int> new_ids(m_num_cells * new_stride);
+
+  for (int i = 0; i < m_num_cells; i++) {
+    cCellConnections& conn = m_cells[i].ConnectionList();
+    int* new_row = new_ids.begin() + i * new_stride;
+    for (int j = 0; j < conn.m_size; j++) new_row[j] = conn.m_row[j];
+  }
+
+  m_ids = new_ids;
+  m_stride = new_stride;
+  for (int i = 0; i < m_num_cells; i++) m_cells[i].ConnectionList().m_row = m_ids.begin() + i * m_stride;
+}
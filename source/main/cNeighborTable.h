@@ -0,0 +1,107 @@
+/*
+ *  cNeighborTable.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cNeighborTable_h
+#define cNeighborTable_h
+
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+
+#include <cassert>
+
+class cNeighborTable;
+class cPopulationCell;
+
+
+// cCellConnections - the neighbors of one population cell
+//
+// Neighbors are stored as cell IDs in this cell's row of the population's cNeighborTable, in the order they were
+// connected.  The cell faced is the neighbor at the facing offset, and positions are counted from it, so rotating
+// only moves the offset.  Positions and edits follow tList, as if the row were a list rotated to start at the cell
+// faced (Push connects a new neighbor and faces it, PushRear connects one just behind the cell faced).  The
+// inline accessors are defined in cPopulationCell.h, where the cells are a complete type.
+class cCellConnections
+{
+  friend class cNeighborTable;
+private:
+  cNeighborTable* m_table;
+  cPopulationCell* m_cells;
+  int* m_row;
+  int m_size;
+  int m_facing;
+
+  void insert(int idx, cPopulationCell* cell);
+
+public:
+  cCellConnections() : m_table(NULL), m_cells(NULL), m_row(NULL), m_size(0), m_facing(0) { ; }
+
+  inline int GetSize() const { return m_size; }
+
+  // Returns the cell faced, or NULL if there are no neighbors
+  inline cPopulationCell* GetFirst() const;
+
+  // Returns the neighbor pos positions after the cell faced, or NULL if there is no such neighbor
+  inline cPopulationCell* GetPos(int pos) const;
+
+  inline int GetFacing() const { return m_facing; }
+  inline void SetFacing(int facing) { assert(facing >= 0 && facing < m_size); m_facing = facing; }
+  inline void CircNext() { if (m_size > 0 && ++m_facing == m_size) m_facing = 0; }
+  inline void CircPrev() { if (m_size > 0 && --m_facing < 0) m_facing = m_size - 1; }
+
+  cPopulationCell* FindPtr(const cPopulationCell* cell) const;
+
+  inline void Push(cPopulationCell* cell) { insert(m_facing, cell); }
+  inline void PushRear(cPopulationCell* cell) { insert(m_facing, cell); m_facing++; }
+  cPopulationCell* Remove(cPopulationCell* cell);
+};
+
+
+// cNeighborTable - neighbor IDs of all of the cells of a population, in one array
+//
+// Each cell has a row of GetStride() entries, so the neighbors of nearby cells are nearby in memory.  Rows start out
+// wide enough for a torus, and all are widened together when a cell is connected to more neighbors than that.
+class cNeighborTable
+{
+  friend class cCellConnections;
+private:
+  tArray<int> m_ids;
+  int m_stride;
+  cPopulationCell* m_cells;
+  int m_num_cells;
+
+  void grow();
+
+  cNeighborTable(const cNeighborTable&); // @not_implemented
+  cNeighborTable& operator=(const cNeighborTable&); // @not_implemented
+
+public:
+  static const int DEFAULT_STRIDE = 8;
+
+  cNeighborTable() : m_stride(0), m_cells(NULL), m_num_cells(0) { ; }
+
+  // Binds the connections of every cell to a new table with no connections
+  void Setup(tArray<cPopulationCell>& cells);
+
+  inline int GetStride() const { return m_stride; }
+};
+
+#endif
@@ -163,6 +163,116 @@ cOrganism::~cOrganism()
   delete m_queued_display_data;
 }
 
+void cOrganism::release()
+{
+  assert(m_is_running == false);
+  if (m_hardware) m_world->GetHardwareManager().Release(m_hardware);
+  m_hardware = NULL;
+  delete m_interface;
+  m_interface = NULL;
+  delete m_net;
+  m_net = NULL;
+  delete m_msg;
+  m_msg = NULL;
+  delete m_opinion;
+  m_opinion = NULL;
+  for (int i = 0; i < m_parasites.GetSize(); i++) delete m_parasites[i];
+  m_parasites.Resize(0);
+  delete m_neighborhood;
+  m_neighborhood = NULL;
+  delete m_org_display;
+  m_org_display = NULL;
+  delete m_queued_display_data;
+  m_queued_display_data = NULL;
+  
+  // As ~cBioUnit
+  for (int i = 0; i < m_bio_groups.GetSize(); i++) m_bio_groups[i]->RemoveBioUnit(this);
+  m_bio_groups.Resize(0);
+}
+
+void cOrganism::recycle(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src,
+                        const cString& src_args)
+{
+  // Mirrors the constructor; members it leaves to their default constructors are cleared here
+  m_phenotype.Recycle(parent_generation, m_world->GetHardwareManager().GetInstSet(genome.GetInstSet()).GetNumNops());
+  m_src = src;
+  m_src_args = src_args;
+  m_initial_genome = genome;
+  m_mut_rates.Clear();
+  m_lineage_label = -1;
+  m_lineage = NULL;
+  m_org_list_index = -1;
+  m_display = false;
+  m_offspring_genome = Genome();
+  m_input_pointer = 0;
+  m_input_buf.Clear();
+  m_output_buf.Clear();
+  m_received_messages.Clear();
+  m_sold_items.Clear();
+  m_cur_sg = 0;
+  m_sent_value = 0;
+  m_sent_active = false;
+  m_test_receive_pos = 0;
+  m_pher_drop = false;
+  frac_energy_donating = m_world->GetConfig().ENERGY_SHARING_PCT.Get();
+  m_max_executed = -1;
+  m_is_running = false;
+  m_is_sleeping = false;
+  m_is_dead = false;
+  killed_event = false;
+  m_self_raw_materials = m_world->GetConfig().RAW_MATERIAL_AMOUNT.Get();
+  m_other_raw_materials = 0;
+  donor_list.clear();
+  donating_lineages.clear();
+  m_num_donate = 0;
+  m_num_donate_received = 0;
+  m_amount_donate_received = 0;
+  m_num_reciprocate = 0;
+  m_failed_reputation_increases = 0;
+  m_tag = make_pair(-1, 0);
+  m_northerly = 0;
+  m_easterly = 0;
+  m_forage_target = -1;
+  m_has_set_ft = false;
+  m_teach = false;
+  m_parent_teacher = false;
+  m_parent_ft = -1;
+  m_parent_group = m_world->GetConfig().DEFAULT_GROUP.Get();
+  m_beggar = false;
+  m_guard = false;
+  m_num_guard = 0;
+  m_num_deposits = 0;
+  m_amount_deposited = 0;
+  m_string_map.clear();
+  m_num_point_mut = 0;
+  m_av_in_index = -1;
+  m_av_out_index = -1;
+  
+  m_id = m_world->GetStats().GetTotCreatures();
+  if (m_hardware) m_hardware->Recycle(ctx, this);
+  else m_hardware = m_world->GetHardwareManager().Create(ctx, this, m_initial_genome);
+  initialize(ctx);
+}
+
+void cOrganism::reload(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src)
+{
+  // The hardware is kept out of the hardware manager's free lists, which are shared (and unlocked) across threads
+  cHardwareBase* hw = m_hardware;
+  m_hardware = NULL;
+  const cInstSet& inst_set = m_world->GetHardwareManager().GetInstSet(genome.GetInstSet());
+  const bool keep_hw = hw->SupportsRecycling() && &hw->GetInstSet() == &inst_set &&
+    inst_set.GetHardwareType() == genome.GetHardwareType() &&
+    m_world->GetConfig().ALLOC_METHOD.Get() != ALLOC_METHOD_NECRO && !m_world->GetConfig().TRACE_EXECUTION.Get();
+  if (!keep_hw) {
+    delete hw;
+    hw = NULL;
+  }
+  
+  release();
+  m_hardware = hw;
+  recycle(ctx, genome, parent_generation, src, "");
+}
+
 cOrganism::cNetSupport::~cNetSupport()
 {
   while (pending.GetSize()) delete pending.Pop();
@@ -777,7 +887,7 @@ void cOrganism::NotifyDeath(cAvidaContext& ctx)
   
   // Return currently stored internal resources to the world
   if (m_world->GetConfig().USE_RESOURCE_BINS.Get() && m_world->GetConfig().RETURN_STORED_ON_DEATH.Get()) {
-  	m_interface->UpdateResources(ctx, GetRBins());
+  	m_interface->UpdateResources(ctx, GetRBins().AsArray());
   }
   
   // Make sure the group composition is updated.
@@ -950,13 +1060,13 @@ bool cOrganism::Divide_CheckViable(cAvidaContext& ctx)
   if (single_reaction != 0)
   {
     bool toFail = true;
-    tArray<int> reactionCounts = m_phenotype.GetCurReactionCount();
+    const tArraySlice<int>& reactionCounts = m_phenotype.GetCurReactionCount();
     for (int i=0; i<reactionCounts.GetSize(); i++) {
       if (reactionCounts[i] > 0) toFail = false;
     }
     
     if (toFail) {
-      const tArray<int> stolenReactions = m_phenotype.GetStolenReactionCount(); 
+      const tArraySlice<int>& stolenReactions = m_phenotype.GetStolenReactionCount();
       for (int i = 0; i < stolenReactions.GetSize(); i++) {
         if (stolenReactions[i] > 0) toFail = false;
       }
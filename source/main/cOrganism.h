@@ -35,6 +35,7 @@
 #include "cOrgSourceMessage.h"
 #include "cOrgMessage.h"
 #include "tArray.h"
+#include "tArraySlice.h"
 #include "tBuffer.h"
 #include "tList.h"
 #include "tSmartArray.h"
@@ -65,13 +66,15 @@ using namespace Avida;
 
 class cOrganism : public cBioUnit
 {
+  friend class cOrganismPool;
+  friend class cTestCPU;
 private:
   cWorld* m_world;
   cHardwareBase* m_hardware;              // The actual machinery running this organism.
   cPhenotype m_phenotype;                 // Descriptive attributes of organism.
   eBioUnitSource m_src;
   cString m_src_args;
-  const Genome m_initial_genome;         // Initial genome; can never be changed!
+  Genome m_initial_genome;               // Initial genome; can never be changed (until recycled by cOrganismPool)!
   tArray<cBioUnit*> m_parasites;   // List of all parasites associated with this organism.
   cMutationRates m_mut_rates;             // Rate of all possible mutations.
   cOrgInterface* m_interface;             // Interface back to the population.
@@ -182,7 +185,7 @@ public:
   void SetCCladeLabel( int in_label ) { cclade_id = in_label; };  //@MRR
   int  GetCCladeLabel() const { return cclade_id; }
 
-  const tArray<double>& GetRBins() const { return m_phenotype.GetCurRBinsAvail(); }
+  const tArraySlice<double>& GetRBins() const { return m_phenotype.GetCurRBinsAvail(); }
   double GetRBin(int index) { return m_phenotype.GetCurRBinAvail(index); }
   double GetRBinsTotal();
   void SetRBins(const tArray<double>& rbins_in);
@@ -754,6 +757,13 @@ private:
   int m_av_out_index;
   
   void initialize(cAvidaContext& ctx);
+  
+  // cOrganismPool support: release() frees what the destructor would, and recycle() then repeats the constructor
+  void release();
+  void recycle(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src,
+               const cString& src_args);
+  // cTestCPU support: as release() and recycle(), but keeping this organism's own hardware when it can be reset in place
+  void reload(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src);
 
   /*! The main DoOutput function.  The DoOutputs above all forward to this function. */
   void doOutput(cAvidaContext& ctx, tBuffer<int>& input_buffer, tBuffer<int>& output_buffer, const bool on_divide, bool is_parasite=false, cContextPhenotype* context_phenotype = 0);
@@ -0,0 +1,59 @@
+/*
+ *  cOrganismPool.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cOrganismPool.h"
+
+#include "cOrganism.h"
+#include "cWorld.h"
+
+
+cOrganismPool::cOrganismPool(cWorld* world)
+: m_world(world), m_enabled(world->GetConfig().RECYCLE_ORGANISMS.Get())
+{
+}
+
+cOrganismPool::~cOrganismPool()
+{
+  for (int i = 0; i < m_free.GetSize(); i++) delete m_free[i];
+}
+
+
+cOrganism* cOrganismPool::Create(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src,
+                                 const cString& src_args)
+{
+  if (m_free.GetSize() == 0) return new cOrganism(m_world, ctx, genome, parent_generation, src, src_args);
+
+  cOrganism* org = m_free.Pop();
+  org->recycle(ctx, genome, parent_generation, src, src_args);
+  return org;
+}
+
+
+void cOrganismPool::Release(cOrganism* org)
+{
+  if (!m_enabled) {
+    delete org;
+    return;
+  }
+
+  org->release();
+  m_free.Push(org);
+}
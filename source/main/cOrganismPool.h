@@ -0,0 +1,74 @@
+/*
+ *  cOrganismPool.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOrganismPool_h
+#define cOrganismPool_h
+
+#include "avida/Avida.h"
+
+#ifndef cString_h
+#include "cString.h"
+#endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
+
+namespace Avida {
+  class Genome;
+};
+
+class cAvidaContext;
+class cOrganism;
+class cWorld;
+
+using namespace Avida;
+
+
+// cOrganismPool - creates the organisms of a population and recycles them when they die
+//
+// A released organism keeps its phenotype arrays and returns its hardware to the cHardwareManager, and both are
+// reset in place for the next organism created, instead of being freed and allocated again.  With
+// RECYCLE_ORGANISMS off, organisms are simply allocated and deleted.
+class cOrganismPool
+{
+private:
+  cWorld* m_world;
+  bool m_enabled;
+  tSmartArray<cOrganism*> m_free;
+
+  cOrganismPool(); // @not_implemented
+  cOrganismPool(const cOrganismPool&); // @not_implemented
+  cOrganismPool& operator=(const cOrganismPool&); // @not_implemented
+
+public:
+  cOrganismPool(cWorld* world);
+  ~cOrganismPool();
+
+  cOrganism* Create(cAvidaContext& ctx, const Genome& genome, int parent_generation, eBioUnitSource src,
+                    const cString& src_args = "");
+
+  // Takes the place of deleting a dead organism
+  void Release(cOrganism* org);
+
+  int GetNumFree() const { return m_free.GetSize(); }
+};
+
+#endif
@@ -24,13 +24,14 @@
 #include <cmath>
 #include <cfloat>
 
-cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx)
+cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx,
+                                       cTestCPU* test_cpu)
 : m_genome(in_genome), m_num_trials(num_trials), m_world(world)
 {
   // Override input mode if more than one recalculation requested
   if (num_trials > 1)  
     test_info.UseRandomInputs(true);
-  Process(test_info, world, ctx);
+  Process(test_info, world, ctx, test_cpu);
 }
 
 cPhenPlastGenotype::~cPhenPlastGenotype()
@@ -42,9 +43,10 @@ cPhenPlastGenotype::~cPhenPlastGenotype()
   }
 }
 
-void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx)
+void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx, cTestCPU* test_cpu)
 {
-  cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  const bool own_test_cpu = (test_cpu == NULL);
+  if (own_test_cpu) test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
 
   if (m_num_trials > 1) test_info.UseRandomInputs(true);
   
@@ -103,7 +105,7 @@ void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaC
     ++uit;
   }
   
-  if (test_cpu) delete test_cpu;
+  if (own_test_cpu) delete test_cpu;
 }
 
 
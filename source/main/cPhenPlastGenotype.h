@@ -73,10 +73,12 @@ class cPhenPlastGenotype
     
     
   
-  void Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx);
+  void Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx, cTestCPU* test_cpu);
   
 public:
-  cPhenPlastGenotype(const Genome& in_genome, int num_trails, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx);
+  // A caller-owned test CPU may be supplied so that it can be reused across many genotypes
+  cPhenPlastGenotype(const Genome& in_genome, int num_trails, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx,
+                     cTestCPU* test_cpu = NULL);
   ~cPhenPlastGenotype();
     
   // Accessors
@@ -39,24 +39,6 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 : m_world(world)
 , initialized(false)
 , energy_store(0.0)
-, cur_task_count(m_world->GetEnvironment().GetNumTasks())
-, cur_para_tasks(m_world->GetEnvironment().GetNumTasks())
-, cur_host_tasks(m_world->GetEnvironment().GetNumTasks())
-, cur_internal_task_count(m_world->GetEnvironment().GetNumTasks())
-, eff_task_count(m_world->GetEnvironment().GetNumTasks())
-, cur_task_quality(m_world->GetEnvironment().GetNumTasks())  
-, cur_task_value(m_world->GetEnvironment().GetNumTasks())  
-, cur_internal_task_quality(m_world->GetEnvironment().GetNumTasks())
-, cur_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, first_reaction_cycles(m_world->GetEnvironment().GetReactionLib().GetSize())
-, first_reaction_execs(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_stolen_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_sense_count(m_world->GetStats().GetSenseSize())
-, sensed_resources(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_task_time(m_world->GetEnvironment().GetNumTasks())   // Added for tracking time; WRE 03-18-07
 , m_tolerance_immigrants()
 , m_tolerance_offspring_own()
 , m_tolerance_offspring_others()
@@ -66,19 +48,7 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , cur_mating_display_a(0)
 , cur_mating_display_b(0)
 , m_reaction_result(NULL)
-, last_task_count(m_world->GetEnvironment().GetNumTasks())
-, last_para_tasks(m_world->GetEnvironment().GetNumTasks())
-, last_host_tasks(m_world->GetEnvironment().GetNumTasks())
-, last_internal_task_count(m_world->GetEnvironment().GetNumTasks())
-, last_task_quality(m_world->GetEnvironment().GetNumTasks())
-, last_task_value(m_world->GetEnvironment().GetNumTasks())
-, last_internal_task_quality(m_world->GetEnvironment().GetNumTasks())
-, last_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
-, last_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
 , last_collect_spec_counts()
-, last_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, last_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())  
-, last_sense_count(m_world->GetStats().GetSenseSize())
 , last_mating_display_a(0)
 , last_mating_display_b(0)
 , generation(0)
@@ -92,6 +62,8 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , last_task_time(0)
 
 { 
+  setupCounters();
+  
   if (parent_generation >= 0) {
     generation = parent_generation;
     if (m_world->GetConfig().GENERATION_INC_METHOD.Get() != GENERATION_INC_BOTH) generation++;
@@ -113,6 +85,145 @@ cPhenotype::~cPhenotype()
 }
 
 
+template <class T> static inline void recycleArray(tArray<T>& arr, int size, const T& value)
+{
+  if (arr.GetSize() != size) arr.ResizeClear(size);
+  arr.SetAll(value);
+}
+
+void cPhenotype::Recycle(int parent_generation, int num_nops)
+{
+  // Mirrors the constructor above.  Values it leaves unset are assigned by SetupOffspring, SetupInject or SetupClone.
+  const int num_resources = m_world->GetEnvironment().GetResourceLib().GetSize();
+  
+  initialized = false;
+  energy_store = 0.0;
+  setupCounters();
+  
+  // Instruction counts are sized by SetInstSetSize, which only zeroes the entries it adds
+  cur_inst_count.SetAll(0);
+  last_inst_count.SetAll(0);
+  
+  tArray<cTaskState*> task_states(0);
+  m_task_states.GetValues(task_states);
+  for (int i = 0; i < task_states.GetSize(); i++) delete task_states[i];
+  m_task_states.ClearAll();
+  
+  cur_trial_fitnesses.Resize(0);
+  cur_trial_bonuses.Resize(0);
+  cur_trial_times_used.Resize(0);
+  m_tolerance_immigrants.Clear();
+  m_tolerance_offspring_own.Clear();
+  m_tolerance_offspring_others.Clear();
+  recycleArray(m_intolerances, (m_world->GetConfig().TOLERANCE_VARIATIONS.Get() > 0) ? 1 : 3, make_pair(0, 0));
+  mating_type = MATING_TYPE_JUVENILE;
+  mate_preference = MATE_PREFERENCE_RANDOM;
+  cur_mating_display_a = 0;
+  cur_mating_display_b = 0;
+  
+  last_collect_spec_counts.Resize(0);
+  last_mating_display_a = 0;
+  last_mating_display_b = 0;
+  
+  generation = 0;
+  birth_cell_id = 0;
+  birth_group_id = 0;
+  birth_forager_type = -1;
+  testCPU_inst_count.Resize(0);
+  last_task_id = -1;
+  num_new_unique_reactions = 0;
+  res_consumed = 0;
+  is_germ_cell = m_world->GetConfig().DEMES_ORGS_START_IN_GERM.Get();
+  last_task_time = 0;
+  is_donor_locus.Resize(0);
+  is_donor_locus_last.Resize(0);
+  
+  if (parent_generation >= 0) {
+    generation = parent_generation;
+    if (m_world->GetConfig().GENERATION_INC_METHOD.Get() != GENERATION_INC_BOTH) generation++;
+  }
+  
+  int num_collect_specs = 0;
+  if (num_resources > 0 && num_nops > 0) {
+    double most_nops_needed = ceil(log((double)num_resources) / log((double)num_nops));
+    num_collect_specs = int((pow((double)num_nops, most_nops_needed + 1.0) - 1.0) / ((double)num_nops - 1.0));
+  }
+  recycleArray(cur_collect_spec_counts, num_collect_specs, 0);
+}
+
+
+void cPhenotype::setupCounters()
+{
+  m_num_tasks = m_world->GetEnvironment().GetNumTasks();
+  m_num_reactions = m_world->GetEnvironment().GetReactionLib().GetSize();
+  m_num_resources = m_world->GetEnvironment().GetResourceLib().GetSize();
+  m_num_senses = m_world->GetStats().GetSenseSize();
+  
+  const int num_cur_ints = 4 * m_num_tasks + m_num_reactions + m_num_senses;
+  const int num_ints = 2 * num_cur_ints + m_num_tasks + 3 * m_num_reactions;
+  const int num_cur_doubles = 3 * m_num_tasks + 2 * m_num_resources + m_num_reactions;
+  const int num_doubles = 2 * num_cur_doubles + m_num_resources + m_num_tasks;
+  
+  if (m_int_counters.GetSize() != num_ints) m_int_counters.ResizeClear(num_ints);
+  if (m_double_counters.GetSize() != num_doubles) m_double_counters.ResizeClear(num_doubles);
+  m_int_counters.SetAll(0);
+  m_double_counters.SetAll(0.0);
+  bindCounters();
+}
+
+void cPhenotype::bindCounters()
+{
+  // The last_* section must follow the cur_* section in the same order, for lockInCounters
+  int* ints = m_int_counters.begin();
+  ints = cur_task_count.Bind(ints, m_num_tasks);
+  ints = cur_para_tasks.Bind(ints, m_num_tasks);
+  ints = cur_host_tasks.Bind(ints, m_num_tasks);
+  ints = cur_internal_task_count.Bind(ints, m_num_tasks);
+  ints = cur_reaction_count.Bind(ints, m_num_reactions);
+  ints = cur_sense_count.Bind(ints, m_num_senses);
+  ints = last_task_count.Bind(ints, m_num_tasks);
+  ints = last_para_tasks.Bind(ints, m_num_tasks);
+  ints = last_host_tasks.Bind(ints, m_num_tasks);
+  ints = last_internal_task_count.Bind(ints, m_num_tasks);
+  ints = last_reaction_count.Bind(ints, m_num_reactions);
+  ints = last_sense_count.Bind(ints, m_num_senses);
+  ints = eff_task_count.Bind(ints, m_num_tasks);
+  ints = first_reaction_cycles.Bind(ints, m_num_reactions);
+  ints = first_reaction_execs.Bind(ints, m_num_reactions);
+  ints = cur_stolen_reaction_count.Bind(ints, m_num_reactions);
+  assert(ints == m_int_counters.end());
+  
+  double* doubles = m_double_counters.begin();
+  doubles = cur_task_quality.Bind(doubles, m_num_tasks);
+  doubles = cur_task_value.Bind(doubles, m_num_tasks);
+  doubles = cur_internal_task_quality.Bind(doubles, m_num_tasks);
+  doubles = cur_rbins_total.Bind(doubles, m_num_resources);
+  doubles = cur_rbins_avail.Bind(doubles, m_num_resources);
+  doubles = cur_reaction_add_reward.Bind(doubles, m_num_reactions);
+  doubles = last_task_quality.Bind(doubles, m_num_tasks);
+  doubles = last_task_value.Bind(doubles, m_num_tasks);
+  doubles = last_internal_task_quality.Bind(doubles, m_num_tasks);
+  doubles = last_rbins_total.Bind(doubles, m_num_resources);
+  doubles = last_rbins_avail.Bind(doubles, m_num_resources);
+  doubles = last_reaction_add_reward.Bind(doubles, m_num_reactions);
+  doubles = sensed_resources.Bind(doubles, m_num_resources);
+  doubles = cur_task_time.Bind(doubles, m_num_tasks);
+  assert(doubles == m_double_counters.end());
+}
+
+void cPhenotype::lockInCounters()
+{
+  // Copies every cur_* counter in the blocks to its last_* counterpart
+  int* ints = m_int_counters.begin();
+  const int num_cur_ints = last_task_count.begin() - cur_task_count.begin();
+  for (int i = 0; i < num_cur_ints; i++) ints[num_cur_ints + i] = ints[i];
+  
+  double* doubles = m_double_counters.begin();
+  const int num_cur_doubles = last_task_quality.begin() - cur_task_quality.begin();
+  for (int i = 0; i < num_cur_doubles; i++) doubles[num_cur_doubles + i] = doubles[i];
+}
+
+
 cPhenotype::cPhenotype(const cPhenotype& in_phen) : m_reaction_result(NULL)
 {
   *this = in_phen;
@@ -125,6 +236,15 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   m_world                  = in_phen.m_world;
   initialized              = in_phen.initialized;
   
+  // Counters sized by the environment are copied block by block
+  m_num_tasks              = in_phen.m_num_tasks;
+  m_num_reactions          = in_phen.m_num_reactions;
+  m_num_resources          = in_phen.m_num_resources;
+  m_num_senses             = in_phen.m_num_senses;
+  m_int_counters           = in_phen.m_int_counters;
+  m_double_counters        = in_phen.m_double_counters;
+  bindCounters();
+  
   
   // 1. These are values calculated at the last divide (of self or offspring)
   merit                    = in_phen.merit;
@@ -148,31 +268,13 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   cur_energy_bonus         = in_phen.cur_energy_bonus;                   
   cur_num_errors           = in_phen.cur_num_errors;                         
   cur_num_donates          = in_phen.cur_num_donates;                       
-  cur_task_count           = in_phen.cur_task_count;  
-  cur_para_tasks           = in_phen.cur_para_tasks;
-  cur_host_tasks           = in_phen.cur_host_tasks;
-  eff_task_count           = in_phen.eff_task_count;
-  cur_internal_task_count  = in_phen.cur_internal_task_count;
-  cur_task_quality         = in_phen.cur_task_quality;    
-  cur_internal_task_quality= in_phen.cur_internal_task_quality;       
-  cur_task_value           = in_phen.cur_task_value;			
-  cur_rbins_total          = in_phen.cur_rbins_total;
-  cur_rbins_avail          = in_phen.cur_rbins_avail;
   cur_collect_spec_counts  = in_phen.cur_collect_spec_counts;
-  cur_reaction_count       = in_phen.cur_reaction_count;            
-  first_reaction_cycles    = in_phen.first_reaction_cycles;            
-  first_reaction_execs     = first_reaction_execs;            
-  cur_reaction_add_reward  = in_phen.cur_reaction_add_reward;     
   cur_inst_count           = in_phen.cur_inst_count;                 
-  cur_sense_count          = in_phen.cur_sense_count;                 
-  sensed_resources         = in_phen.sensed_resources;            
-  cur_task_time            = in_phen.cur_task_time;
   m_tolerance_immigrants          = in_phen.m_tolerance_immigrants;
   m_tolerance_offspring_own       = in_phen.m_tolerance_offspring_own;
   m_tolerance_offspring_others    = in_phen.m_tolerance_offspring_others;
   m_intolerances                  = in_phen.m_intolerances;
   cur_child_germline_propensity = in_phen.cur_child_germline_propensity;
-  cur_stolen_reaction_count       = in_phen.cur_stolen_reaction_count;  
   mating_type = in_phen.mating_type; //@CHC
   mate_preference = in_phen.mate_preference; //@CHC
   cur_mating_display_a = in_phen.cur_mating_display_a;
@@ -198,20 +300,8 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_energy_bonus        = in_phen.last_energy_bonus; 
   last_num_errors          = in_phen.last_num_errors; 
   last_num_donates         = in_phen.last_num_donates;
-  last_task_count          = in_phen.last_task_count;
-  last_host_tasks          = in_phen.last_host_tasks;
-  last_para_tasks          = in_phen.last_para_tasks;
-  last_internal_task_count = in_phen.last_internal_task_count;
-  last_task_quality        = in_phen.last_task_quality;
-  last_internal_task_quality=in_phen.last_internal_task_quality;
-  last_task_value          = in_phen.last_task_value;
-  last_rbins_total         = in_phen.last_rbins_total;
-  last_rbins_avail         = in_phen.last_rbins_avail;
   last_collect_spec_counts = in_phen.last_collect_spec_counts;
-  last_reaction_count      = in_phen.last_reaction_count;
-  last_reaction_add_reward = in_phen.last_reaction_add_reward; 
   last_inst_count          = in_phen.last_inst_count;	  
-  last_sense_count         = in_phen.last_sense_count;   
   last_fitness             = in_phen.last_fitness;            
   last_child_germline_propensity = in_phen.last_child_germline_propensity;
   total_energy_donated     = in_phen.total_energy_donated;
@@ -804,20 +894,9 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   //TODO?  last_energy         = cur_energy_bonus;
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
-  last_task_count           = cur_task_count;
-  last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
-  last_internal_task_count  = cur_internal_task_count;
-  last_task_quality         = cur_task_quality;
-  last_task_value           = cur_task_value;
-  last_internal_task_quality= cur_internal_task_quality;
-  last_rbins_total          = cur_rbins_total;
-  last_rbins_avail          = cur_rbins_avail;
+  lockInCounters();         // task, reaction, sense and resource bin counters
   last_collect_spec_counts  = cur_collect_spec_counts;
-  last_reaction_count       = cur_reaction_count;
-  last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
-  last_sense_count          = cur_sense_count;
   last_child_germline_propensity = cur_child_germline_propensity;
   
   last_mating_display_a = cur_mating_display_a; //@CHC
@@ -1015,20 +1094,9 @@ void cPhenotype::TestDivideReset(const Sequence& _genome)
   last_cpu_cycles_used      = cpu_cycles_used;
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
-  last_task_count           = cur_task_count;
-  last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
-  last_internal_task_count  = cur_internal_task_count;
-  last_task_quality         = cur_task_quality;
-  last_task_value			= cur_task_value;
-  last_internal_task_quality= cur_internal_task_quality;
-  last_rbins_total          = cur_rbins_total;
-  last_rbins_avail          = cur_rbins_avail;
+  lockInCounters();         // task, reaction, sense and resource bin counters
   last_collect_spec_counts  = cur_collect_spec_counts;
-  last_reaction_count       = cur_reaction_count;
-  last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
-  last_sense_count          = cur_sense_count;  
   last_child_germline_propensity = cur_child_germline_propensity;
   
   // Reset cur values.
@@ -1373,7 +1441,7 @@ bool cPhenotype::TestInput(tBuffer<int>& inputs, tBuffer<int>& outputs)
 }
 
 bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                            const tArray<double>& res_in, const tArray<double>& rbins_in,
+                            const tArray<double>& res_in, const tArraySlice<double>& rbins_in,
                             tArray<double>& res_change, tArray<cString>& insts_triggered,
                             bool is_parasite, cContextPhenotype* context_phenotype)
 {
@@ -2187,8 +2255,8 @@ int cPhenotype::Compare(const cPhenotype* lhs, const cPhenotype* rhs) {
   else if ( lhs->GetGestationTime() > rhs->GetGestationTime() ) return 1;
   
   // If gestation times are also equal, compare each task
-  tArray<int> lhsTasks = lhs->GetLastTaskCount();
-  tArray<int> rhsTasks = rhs->GetLastTaskCount();
+  const tArraySlice<int>& lhsTasks = lhs->GetLastTaskCount();
+  const tArraySlice<int>& rhsTasks = rhs->GetLastTaskCount();
   for (int k = 0; k < lhsTasks.GetSize(); k++) {
     if (lhsTasks[k] < rhsTasks[k]) return -1;
     else if (lhsTasks[k] > rhsTasks[k]) return 1;
@@ -2250,7 +2318,7 @@ double cPhenotype::GetResourcesConsumed()
 }
 
 //Deep copy parasite task count
-void cPhenotype::SetLastParasiteTaskCount(tArray<int> oldParaPhenotype)
+void cPhenotype::SetLastParasiteTaskCount(const tArraySlice<int>& oldParaPhenotype)
 {
   assert(initialized == true);
   
@@ -2272,6 +2340,6 @@ tArray<int> cPhenotype::GetCumulativeReactionCount()
 //    return (cur_reaction_count + last_reaction_count); 
     return cum_react;
   } else {
-    return cur_reaction_count;
+    return cur_reaction_count.AsArray();
   }
 }
@@ -36,6 +36,9 @@
 #ifndef tArray_h
 #include "tArray.h"
 #endif
+#ifndef tArraySlice_h
+#include "tArraySlice.h"
+#endif
 #ifndef cCodeLabel_h
 #include "cCodeLabel.h"
 #endif
@@ -93,6 +96,15 @@ private:
   cWorld* m_world;
   bool initialized;
 
+  // Counters sized by the environment (the tArraySlice members below) are packed into one block of each type: the
+  // cur_* counters, then the last_* counters in the same order, then the counters kept without a last_* copy.
+  int m_num_tasks;
+  int m_num_reactions;
+  int m_num_resources;
+  int m_num_senses;
+  tArray<int> m_int_counters;
+  tArray<double> m_double_counters;
+
   // 1. These are values calculated at the last divide (of self or offspring)
   cMerit merit;             // Relative speed of CPU
   double executionRatio;    //  ratio of current execution merit over base execution merit
@@ -122,26 +134,26 @@ private:
   int num_energy_applications;                // Number of times organism has applied donated energy to its energy store
   int cur_num_errors;                         // Total instructions executed illeagally.
   int cur_num_donates;                        // Number of donations so far
-  tArray<int> cur_task_count;                 // Total times each task was performed
-  tArray<int> cur_para_tasks;                 // Total times each task was performed by the parasite @LZ
-  tArray<int> cur_host_tasks;                 // Total times each task was done by JUST the host @LZ
-  tArray<int> cur_internal_task_count;        // Total times each task was performed using internal resources
-  tArray<int> eff_task_count;                 // Total times each task was performed (resetable during the life of the organism)
-  tArray<double> cur_task_quality;            // Average (total?) quality with which each task was performed
-  tArray<double> cur_task_value;              // Value with which this phenotype performs task
-  tArray<double> cur_internal_task_quality;   // Average (total?) quaility with which each task using internal resources was performed
-  tArray<double> cur_rbins_total;             // Total amount of resources collected over the organism's life
-  tArray<double> cur_rbins_avail;             // Amount of internal resources available
+  tArraySlice<int> cur_task_count;            // Total times each task was performed
+  tArraySlice<int> cur_para_tasks;            // Total times each task was performed by the parasite @LZ
+  tArraySlice<int> cur_host_tasks;            // Total times each task was done by JUST the host @LZ
+  tArraySlice<int> cur_internal_task_count;   // Total times each task was performed using internal resources
+  tArraySlice<int> eff_task_count;            // Total times each task was performed (resetable during the life of the organism)
+  tArraySlice<double> cur_task_quality;       // Average (total?) quality with which each task was performed
+  tArraySlice<double> cur_task_value;         // Value with which this phenotype performs task
+  tArraySlice<double> cur_internal_task_quality; // Average (total?) quaility with which each task using internal resources was performed
+  tArraySlice<double> cur_rbins_total;        // Total amount of resources collected over the organism's life
+  tArraySlice<double> cur_rbins_avail;        // Amount of internal resources available
   tArray<int> cur_collect_spec_counts;        // How many times each nop-specification was used in a collect-type instruction
-  tArray<int> cur_reaction_count;             // Total times each reaction was triggered.  
-  tArray<int> first_reaction_cycles;          // CPU cycles of first time reaction was triggered.  
-  tArray<int> first_reaction_execs;            // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).  
-  tArray<int> cur_stolen_reaction_count;      // Total counts of reactions stolen by predators. 
-  tArray<double> cur_reaction_add_reward;     // Bonus change from triggering each reaction.
+  tArraySlice<int> cur_reaction_count;        // Total times each reaction was triggered.  
+  tArraySlice<int> first_reaction_cycles;     // CPU cycles of first time reaction was triggered.  
+  tArraySlice<int> first_reaction_execs;      // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).  
+  tArraySlice<int> cur_stolen_reaction_count; // Total counts of reactions stolen by predators. 
+  tArraySlice<double> cur_reaction_add_reward; // Bonus change from triggering each reaction.
   tArray<int> cur_inst_count;                 // Instruction exection counter
-  tArray<int> cur_sense_count;                // Total times resource combinations have been sensed; @JEB 
-  tArray<double> sensed_resources;            // Resources which the organism has sensed; @JEB 
-  tArray<double> cur_task_time;               // Time at which each task was last performed; WRE 03-18-07
+  tArraySlice<int> cur_sense_count;           // Total times resource combinations have been sensed; @JEB 
+  tArraySlice<double> sensed_resources;       // Resources which the organism has sensed; @JEB 
+  tArraySlice<double> cur_task_time;          // Time at which each task was last performed; WRE 03-18-07
   tHashMap<void*, cTaskState*> m_task_states;
   tArray<double> cur_trial_fitnesses;         // Fitnesses of various trials.; @JEB
   tArray<double> cur_trial_bonuses;           // Bonuses of various trials.; @JEB
@@ -170,20 +182,20 @@ private:
   double last_energy_bonus;
   int last_num_errors;
   int last_num_donates;
-  tArray<int> last_task_count;
-  tArray<int> last_para_tasks;
-  tArray<int> last_host_tasks;                // Last task counts from hosts only, before last divide @LZ
-  tArray<int> last_internal_task_count;
-  tArray<double> last_task_quality;
-  tArray<double> last_task_value;
-  tArray<double> last_internal_task_quality;
-  tArray<double> last_rbins_total;
-  tArray<double> last_rbins_avail;
+  tArraySlice<int> last_task_count;
+  tArraySlice<int> last_para_tasks;
+  tArraySlice<int> last_host_tasks;           // Last task counts from hosts only, before last divide @LZ
+  tArraySlice<int> last_internal_task_count;
+  tArraySlice<double> last_task_quality;
+  tArraySlice<double> last_task_value;
+  tArraySlice<double> last_internal_task_quality;
+  tArraySlice<double> last_rbins_total;
+  tArraySlice<double> last_rbins_avail;
   tArray<int> last_collect_spec_counts;
-  tArray<int> last_reaction_count;
-  tArray<double> last_reaction_add_reward; 
+  tArraySlice<int> last_reaction_count;
+  tArraySlice<double> last_reaction_add_reward; 
   tArray<int> last_inst_count;	  // Instruction exection counter
-  tArray<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB 
+  tArraySlice<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB 
   double last_fitness;            // Used to determine sterilization.
   int last_cpu_cycles_used;
   double cur_child_germline_propensity;   // chance of child being a germline cell; @JEB
@@ -302,15 +314,21 @@ private:
   
 
   inline void SetInstSetSize(int inst_set_size);
+  void setupCounters();
+  void bindCounters();
+  void lockInCounters();
   
 public:
-  cPhenotype() : m_world(NULL), m_reaction_result(NULL) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme tArray usage.
+  cPhenotype() : m_world(NULL), m_num_tasks(0), m_num_reactions(0), m_num_resources(0), m_num_senses(0), m_reaction_result(NULL) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme tArray usage.
   cPhenotype(cWorld* world, int parent_generation, int num_nops);
 
 
   cPhenotype(const cPhenotype&); 
   cPhenotype& operator=(const cPhenotype&); 
   ~cPhenotype();
+
+  // Returns the phenotype of a dead organism to the state of a newly constructed one, reusing its array storage
+  void Recycle(int parent_generation, int num_nops);
   
   enum energy_levels {ENERGY_LEVEL_LOW = 0, ENERGY_LEVEL_MEDIUM, ENERGY_LEVEL_HIGH};
 	
@@ -335,7 +353,7 @@ public:
   // Input and Output Reaction Tests
   bool TestInput(tBuffer<int>& inputs, tBuffer<int>& outputs);
   bool TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                  const tArray<double>& res_in, const tArray<double>& rbins_in, tArray<double>& res_change,
+                  const tArray<double>& res_in, const tArraySlice<double>& rbins_in, tArray<double>& res_change,
                   tArray<cString>& insts_triggered, bool is_parasite=false, cContextPhenotype* context_phenotype = 0);
 
   // State saving and loading, and printing...
@@ -407,29 +425,29 @@ public:
   bool GetToDelete() const { assert(initialized == true); return to_delete; }
   int GetCurNumErrors() const { assert(initialized == true); return cur_num_errors; }
   int GetCurNumDonates() const { assert(initialized == true); return cur_num_donates; }
-  const tArray<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
-  const tArray<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
-  const tArray<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
-  const tArray<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
+  const tArraySlice<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
+  const tArraySlice<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
+  const tArraySlice<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
+  const tArraySlice<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
   void ClearEffTaskCount() { assert(initialized == true); eff_task_count.SetAll(0); }
-  const tArray<double> & GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
-  const tArray<double> & GetCurTaskValue() const { assert(initialized == true); return cur_task_value; }
-  const tArray<double> & GetCurInternalTaskQuality() const { assert(initialized == true); return cur_internal_task_quality; }
-  const tArray<double>& GetCurRBinsTotal() const { assert(initialized == true); return cur_rbins_total; }
+  const tArraySlice<double>& GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
+  const tArraySlice<double>& GetCurTaskValue() const { assert(initialized == true); return cur_task_value; }
+  const tArraySlice<double>& GetCurInternalTaskQuality() const { assert(initialized == true); return cur_internal_task_quality; }
+  const tArraySlice<double>& GetCurRBinsTotal() const { assert(initialized == true); return cur_rbins_total; }
   double GetCurRBinTotal(int index) const { assert(initialized == true); return cur_rbins_total[index]; }
-  const tArray<double>& GetCurRBinsAvail() const { assert(initialized == true); return cur_rbins_avail; }
+  const tArraySlice<double>& GetCurRBinsAvail() const { assert(initialized == true); return cur_rbins_avail; }
   double GetCurRBinAvail(int index) const { assert(initialized == true); return cur_rbins_avail[index]; }
   
-  const tArray<int>& GetCurReactionCount() const { assert(initialized == true); return cur_reaction_count;}
-  const tArray<int>& GetFirstReactionCycles() const { assert(initialized == true); return first_reaction_cycles;}
+  const tArraySlice<int>& GetCurReactionCount() const { assert(initialized == true); return cur_reaction_count;}
+  const tArraySlice<int>& GetFirstReactionCycles() const { assert(initialized == true); return first_reaction_cycles;}
   void SetFirstReactionCycle(int idx) { if (first_reaction_cycles[idx] < 0) first_reaction_cycles[idx] = time_used; }
-  const tArray<int>& GetFirstReactionExecs() const { assert(initialized == true); return first_reaction_execs;}
+  const tArraySlice<int>& GetFirstReactionExecs() const { assert(initialized == true); return first_reaction_execs;}
   void SetFirstReactionExec(int idx) { if (first_reaction_execs[idx] < 0) first_reaction_execs[idx] = num_execs; }
   
-  const tArray<int>& GetStolenReactionCount() const { assert(initialized == true); return cur_stolen_reaction_count;}
-  const tArray<double>& GetCurReactionAddReward() const { assert(initialized == true); return cur_reaction_add_reward;}
+  const tArraySlice<int>& GetStolenReactionCount() const { assert(initialized == true); return cur_stolen_reaction_count;}
+  const tArraySlice<double>& GetCurReactionAddReward() const { assert(initialized == true); return cur_reaction_add_reward;}
   const tArray<int>& GetCurInstCount() const { assert(initialized == true); return cur_inst_count; }
-  const tArray<int>& GetCurSenseCount() const { assert(initialized == true); return cur_sense_count; }
+  const tArraySlice<int>& GetCurSenseCount() const { assert(initialized == true); return cur_sense_count; }
   double GetSensedResource(int _in) { assert(initialized == true); return sensed_resources[_in]; }
   const tArray<int>& GetCurCollectSpecCounts() const { assert(initialized == true); return cur_collect_spec_counts; }
   int GetCurCollectSpecCount(int spec_id) const { assert(initialized == true); return cur_collect_spec_counts[spec_id]; }
@@ -455,21 +473,21 @@ public:
   double GetLastMerit() const { assert(initialized == true); return last_merit_base*last_bonus; }
   int GetLastNumErrors() const { assert(initialized == true); return last_num_errors; }
   int GetLastNumDonates() const { assert(initialized == true); return last_num_donates; }
-  const tArray<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
-  void SetLastTaskCount(tArray<int> tasks) { assert(initialized == true); last_task_count = tasks; }
-  const tArray<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
-  const tArray<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
-  void  SetLastParasiteTaskCount(tArray<int>  oldParaPhenotype);
-  const tArray<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
-  const tArray<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
-  const tArray<double>& GetLastTaskValue() const { assert(initialized == true); return last_task_value; }
-  const tArray<double>& GetLastInternalTaskQuality() const { assert(initialized == true); return last_internal_task_quality; }
-  const tArray<double>& GetLastRBinsTotal() const { assert(initialized == true); return last_rbins_total; }
-  const tArray<double>& GetLastRBinsAvail() const { assert(initialized == true); return last_rbins_avail; }
-  const tArray<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
-  const tArray<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
+  const tArraySlice<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
+  void SetLastTaskCount(const tArraySlice<int>& tasks) { assert(initialized == true); last_task_count = tasks; }
+  const tArraySlice<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
+  const tArraySlice<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
+  void  SetLastParasiteTaskCount(const tArraySlice<int>& oldParaPhenotype);
+  const tArraySlice<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
+  const tArraySlice<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
+  const tArraySlice<double>& GetLastTaskValue() const { assert(initialized == true); return last_task_value; }
+  const tArraySlice<double>& GetLastInternalTaskQuality() const { assert(initialized == true); return last_internal_task_quality; }
+  const tArraySlice<double>& GetLastRBinsTotal() const { assert(initialized == true); return last_rbins_total; }
+  const tArraySlice<double>& GetLastRBinsAvail() const { assert(initialized == true); return last_rbins_avail; }
+  const tArraySlice<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
+  const tArraySlice<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
   const tArray<int>& GetLastInstCount() const { assert(initialized == true); return last_inst_count; }
-  const tArray<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
+  const tArraySlice<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
   double GetLastFitness() const { assert(initialized == true); return last_fitness; }
   double GetPermanentGermlinePropensity() const { assert(initialized == true); return permanent_germline_propensity; }
   const tArray<int>& GetLastCollectSpecCounts() const { assert(initialized == true); return last_collect_spec_counts; }
@@ -22,6 +22,7 @@
 
 #include "cPopulation.h"
 
+#include "apto/platform.h"
 #include "avida/core/Sequence.h"
 
 #include "AvidaTools.h"
@@ -55,6 +56,7 @@
 #include "cRandom.h"
 #include "cResource.h"
 #include "cResourceCount.h"
+#include "cResourceUpdateQueue.h"
 #include "cSaleItem.h"
 #include "cStats.h"
 #include "cTestCPU.h"
@@ -87,7 +89,9 @@ cPopulation::cPopulation(cWorld* world)
 : m_world(world)
 , schedule(NULL)
 //, resource_count(world->GetEnvironment().GetResourceLib().GetSize())
+, m_resource_update_queue(NULL)
 , birth_chamber(world)
+, m_org_pool(world)
 , print_mini_trace_genomes(false)
 , use_micro_traces(false)
 , m_next_prey_q(0)
@@ -98,6 +102,8 @@ cPopulation::cPopulation(cWorld* world)
 , num_pred_organisms(0)
 , pop_enforce(0)
 , m_has_predatory_res(false)
+, m_lazy_deme_time(world->GetConfig().DEMES_LAZY_RESOURCE_TIME.Get())
+, m_deme_time(0.0)
 , sync_events(false)
 , m_hgt_resid(-1)
 {
@@ -182,6 +188,7 @@ cPopulation::cPopulation(cWorld* world)
       reaper_queue.Push(&(cell_array[i]));
     }
   }
+  m_neighbors.Setup(cell_array);
   
   // What are the sizes of the demes that we're creating?
   const int deme_size_x = world_x;
@@ -201,6 +208,7 @@ cPopulation::cPopulation(cWorld* world)
       cell_array[cell_id].SetDemeID(deme_id);
     }
     deme_array[deme_id].Setup(deme_id, deme_cells, deme_size_x, m_world);
+    if (m_lazy_deme_time) deme_array[deme_id].GetDemeResources().SetSharedTime(&m_deme_time);
   }
   
   // Setup the topology.
@@ -338,6 +346,14 @@ cPopulation::cPopulation(cWorld* world)
     m_world->GetDriver().NotifyWarning("HGT is enabled, but no HGT resource is defined; add hgt=1 to a single resource in the environment file.");
   }
   min_prey_failures.Resize(0);
+  
+  // Spatial resources may be updated by a pool of worker threads
+  int res_threads = m_world->GetConfig().RESOURCE_UPDATE_THREADS.Get();
+  if (res_threads < 0) res_threads = Apto::Platform::AvailableCPUs();
+  if (res_threads > 1) {
+    m_resource_update_queue = new cResourceUpdateQueue(res_threads);
+    resource_count.SetUpdateQueue(m_resource_update_queue);
+  }
 }
 
 bool cPopulation::InitiatePop(cUserFeedback* feedback)
@@ -364,6 +380,7 @@ cPopulation::~cPopulation()
 {
   for (int i = 0; i < cell_array.GetSize(); i++) KillOrganism(cell_array[i], m_world->GetDefaultContext()); 
   delete schedule;
+  delete m_resource_update_queue;
 }
 
 
@@ -436,7 +453,7 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
       if (m_world->TestForMigration()) {
         // this offspring is outta here!
         m_world->MigrateOrganism(offspring_array[i], parent_cell, merit_array[i], parent_organism->GetLineageLabel());
-        delete offspring_array[i]; // this offspring isn't hanging around.
+        m_org_pool.Release(offspring_array[i]); // this offspring isn't hanging around.
       } else {
         // boring; stay here.
         non_migrants.Push(offspring_array[i]);
@@ -627,7 +644,7 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
         }
       }
     } else {
-      delete offspring_array[i];
+      m_org_pool.Release(offspring_array[i]);
     }
   }
   return parent_alive;
@@ -681,8 +698,8 @@ bool cPopulation::TestForParasiteInteraction(cOrganism* infected_host, cOrganism
   
   cPhenotype& parent_phenotype = infected_host->GetPhenotype();
   
-  tArray<int> host_task_counts = target_host->GetPhenotype().GetLastHostTaskCount();
-  tArray<int> parasite_task_counts = parent_phenotype.GetLastParasiteTaskCount();
+  const tArraySlice<int>& host_task_counts = target_host->GetPhenotype().GetLastHostTaskCount();
+  const tArraySlice<int>& parasite_task_counts = parent_phenotype.GetLastParasiteTaskCount();
   
   
   if (infection_mechanism == 0) {
@@ -1797,7 +1814,7 @@ void cPopulation::KillOrganism(cPopulationCell& in_cell, cAvidaContext& ctx)
   
   // And clear it!
   in_cell.RemoveOrganism(ctx); 
-  if (!organism->IsRunning()) delete organism;
+  if (!organism->IsRunning()) m_org_pool.Release(organism);
   else organism->GetPhenotype().SetToDelete();
   
   // Alert the scheduler that this cell has a 0 merit.
@@ -3440,7 +3457,7 @@ bool cPopulation::SeedDeme(cDeme& source_deme, cDeme& target_deme, cAvidaContext
         old_target_organisms[i]->SetRunning(false);
         // ONLY delete target orgs if seeding was successful
         // otherwise they still exist in the population!!!
-        if (successfully_seeded) delete old_target_organisms[i];
+        if (successfully_seeded) m_org_pool.Release(old_target_organisms[i]);
       }
       
       for(int i=0; i<old_source_organisms.GetSize(); ++i) {
@@ -3449,7 +3466,7 @@ bool cPopulation::SeedDeme(cDeme& source_deme, cDeme& target_deme, cAvidaContext
         // delete old source organisms ONLY if source was replaced
         if ( (m_world->GetConfig().DEMES_DIVIDE_METHOD.Get() == 0)
             || (m_world->GetConfig().DEMES_DIVIDE_METHOD.Get() == 1) ) {
-          delete old_source_organisms[i];
+          m_org_pool.Release(old_source_organisms[i]);
         }
       }
       
@@ -3699,7 +3716,7 @@ void cPopulation::DivideDemes(cAvidaContext& ctx)
       cOrganism * org1 = cell_array[cell1_id].GetOrganism();
       
       // Keep track of what tasks have been done.
-      const tArray<int> & cur_tasks = org1->GetPhenotype().GetLastTaskCount();
+      const tArraySlice<int>& cur_tasks = org1->GetPhenotype().GetLastTaskCount();
       for (int i = 0; i < num_tasks; i++) {
         tot_tasks[i] += cur_tasks[i];
       }
@@ -4799,12 +4816,12 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
   tList<cPopulationCell> found_list;
   
   // First, check if there is an empty organism to work with (always preferred)
-  tList<cPopulationCell>& conn_list = parent_cell.ConnectionList();
+  cCellConnections& conn_list = parent_cell.ConnectionList();
   
   const bool prefer_empty = m_world->GetConfig().PREFER_EMPTY.Get();
   
   if (birth_method == POSITION_OFFSPRING_DISPERSAL && conn_list.GetSize() > 0) {
-    tList<cPopulationCell>* disp_list = &conn_list;
+    cCellConnections* disp_list = &conn_list;
     
     // hop through connection lists based on the dispersal rate
     int hops = m_world->GetRandom().GetRandPoisson(m_world->GetConfig().DISPERSAL_RATE.Get());
@@ -4818,7 +4835,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
     
     // if prefer empty is off, or there are no empty cells, use the whole connection list as possiblities
     if (found_list.GetSize() == 0) {
-      found_list = *disp_list;
+      for (int i = 0; i < disp_list->GetSize(); i++) found_list.PushRear(disp_list->GetPos(i));
       // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
       if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
     }
@@ -4837,7 +4854,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
         PositionMerit(parent_cell, found_list, parent_ok);
         break;
       case POSITION_OFFSPRING_RANDOM:
-        found_list.Append(conn_list);
+        for (int i = 0; i < conn_list.GetSize(); i++) found_list.PushRear(conn_list.GetPos(i));
         if (parent_ok == true) found_list.Push(&parent_cell);
         break;
       case POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED:
@@ -4868,10 +4885,9 @@ void cPopulation::PositionAge(cPopulationCell & parent_cell,
   if (parent_ok == false) max_age = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_age = test_cell->GetOrganism()->GetPhenotype().GetAge();
     if (cur_age > max_age) {
       max_age = cur_age;
@@ -4896,10 +4912,9 @@ void cPopulation::PositionMerit(cPopulationCell & parent_cell,
   if (parent_ok == false) max_ratio = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const double cur_ratio = test_cell->GetOrganism()->CalcMeritRatio();
     if (cur_ratio > max_ratio) {
       max_ratio = cur_ratio;
@@ -4924,10 +4939,9 @@ void cPopulation::PositionEnergyUsed(cPopulationCell & parent_cell,
   if (parent_ok == false) max_energy_used = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_energy_used = test_cell->GetOrganism()->GetPhenotype().GetTimeUsed();
     if (cur_energy_used > max_energy_used) {
       max_energy_used = cur_energy_used;
@@ -5160,15 +5174,19 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   double merit = cur_org->GetPhenotype().GetMerit().GetDouble();
   if (cur_org->GetPhenotype().GetToDelete() == true) {
     cur_org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs);
-    delete cur_org;
+    m_org_pool.Release(cur_org);
   }
   
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
   
   // These must be done even if there is only one deme.
-  for(int i = 0; i < GetNumDemes(); i++) {
-    GetDeme(i).Update(step_size);
+  if (m_lazy_deme_time) {
+    m_deme_time += step_size;
+  } else {
+    for(int i = 0; i < GetNumDemes(); i++) {
+      GetDeme(i).Update(step_size);
+    }
   }
   
   cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
@@ -5213,7 +5231,8 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   // Deme specific
   if (GetNumDemes() > 1) {
-    for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
+    if (m_lazy_deme_time) m_deme_time += step_size;
+    else for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
     
     cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
@@ -5222,7 +5241,7 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   if (cur_org->GetPhenotype().GetToDelete() == true) {
     cur_org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs);
-    delete cur_org;
+    m_org_pool.Release(cur_org);
     cur_org = NULL;
   }
   
@@ -5610,6 +5629,12 @@ void cPopulation::ProcessPreUpdate()
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  // Hand the time accumulated on the shared deme clock to each deme, then restart the clock for the next update
+  if (m_lazy_deme_time) {
+    for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].GetDemeResources().FlushSharedTime();
+    m_deme_time = 0.0;
+  }
+  
   ProcessUpdateCellActions(ctx);
   
   cStats& stats = m_world->GetStats();
@@ -6138,7 +6163,7 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
       
       assert(tmp.bg->HasProperty("genome"));
       Genome mg(tmp.bg->GetProperty("genome").AsString());
-      cOrganism* new_organism = new cOrganism(m_world, ctx, mg, -1, SRC_ORGANISM_FILE_LOAD);
+      cOrganism* new_organism = m_org_pool.Create(ctx, mg, -1, SRC_ORGANISM_FILE_LOAD);
       
       // Setup the phenotype...
       cPhenotype& phenotype = new_organism->GetPhenotype();
@@ -6580,13 +6605,11 @@ void cPopulation::BuildTimeSlicer()
 }
 
 
-void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
+void cPopulation::FindEmptyCell(const cCellConnections& cell_list,
                                 tList<cPopulationCell> & found_list)
 {
-  tListIterator<cPopulationCell> cell_it(cell_list);
-  cPopulationCell * test_cell;
-  
-  while ( (test_cell = cell_it.Next()) != NULL) {
+  for (int i = 0; i < cell_list.GetSize(); i++) {
+    cPopulationCell* test_cell = cell_list.GetPos(i);
     // If this cell is empty, add it to the list...
     if (test_cell->IsOccupied() == false) found_list.Push(test_cell);
   }
@@ -6602,7 +6625,7 @@ void cPopulation::InjectClone(int cell_id, cOrganism& orig_org, eBioUnitSource s
   
   cAvidaContext& ctx = m_world->GetDefaultContext();
   
-  cOrganism* new_organism = new cOrganism(m_world, ctx, orig_org.GetGenome(), orig_org.GetPhenotype().GetGeneration(), src);
+  cOrganism* new_organism = m_org_pool.Create(ctx, orig_org.GetGenome(), orig_org.GetPhenotype().GetGeneration(), src);
   
   // Classify the new organism
   m_world->GetClassificationManager().ClassifyNewBioUnit(new_organism);
@@ -6645,7 +6668,7 @@ void cPopulation::CompeteOrganisms_ConstructOffspring(int cell_id, cOrganism& pa
   Genome child_genome = parent.OffspringGenome();
   parent.GetHardware().Divide_TestFitnessMeasures(ctx);
   parent.OffspringGenome() = save_child;
-  cOrganism* new_organism = new cOrganism(m_world, ctx, child_genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_COMPETE);
+  cOrganism* new_organism = m_org_pool.Create(ctx, child_genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_COMPETE);
   
   // Classify the offspring
   tArray<const tArray<cBioGroup*>*> pgrps(1);
@@ -6686,7 +6709,7 @@ void cPopulation::InjectGenome(int cell_id, eBioUnitSource src, const Genome& ge
   
   cAvidaContext& ctx = m_world->GetDefaultContext();
   
-  cOrganism* new_organism = new cOrganism(m_world, ctx, genome, -1, src);
+  cOrganism* new_organism = m_org_pool.Create(ctx, genome, -1, src);
   
   // Setup the phenotype...
   cPhenotype& phenotype = new_organism->GetPhenotype();
@@ -26,6 +26,7 @@
 #include "cBirthChamber.h"
 #include "cDeme.h"
 #include "cOrgInterface.h"
+#include "cOrganismPool.h"
 #include "cPopulationInterface.h"
 #include "cResourceCount.h"
 #include "cString.h"
@@ -49,6 +50,7 @@ class cEnvironment;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cResourceUpdateQueue;
 class cSchedule;
 class cSaleItem;
 
@@ -62,9 +64,12 @@ private:
   cWorld* m_world;
   cSchedule* schedule;                // Handles allocation of CPU cycles
   tArray<cPopulationCell> cell_array;  // Local cells composing the population
+  cNeighborTable m_neighbors;          // Connections between the cells
   tArray<int> empty_cell_id_array;     // Used for PREFER_EMPTY birth methods
   cResourceCount resource_count;       // Global resources available
+  cResourceUpdateQueue* m_resource_update_queue; // Worker threads for spatial resource updates (if enabled)
   cBirthChamber birth_chamber;         // Global birth chamber.
+  cOrganismPool m_org_pool;            // Creates organisms, recycling the dead
   tArray<tList<cSaleItem> > market;   // list of lists of items for sale, each list goes with 1 label
   //Keeps track of which organisms are in which group.
   tArrayMap<int, tSmartArray<cOrganism*> > group_list;
@@ -105,6 +110,8 @@ private:
   bool m_has_predatory_res;
   
   tArray<cDeme> deme_array;            // Deme structure of the population.
+  bool m_lazy_deme_time;               // Advance deme resources through a shared clock (DEMES_LAZY_RESOURCE_TIME)
+  double m_deme_time;                  // Time elapsed since deme resources were last flushed
  
   // Outside interactions...
   bool sync_events;   // Do we need to sync up the event list with population?
@@ -290,6 +297,7 @@ public:
   tArray<int>* GetWallCells(int res_id) { return resource_count.GetWallCells(res_id); }
 
   cBirthChamber& GetBirthChamber(int id) { (void) id; return birth_chamber; }
+  cOrganismPool& GetOrganismPool() { return m_org_pool; }
 
   void UpdateResources(cAvidaContext& ctx, const tArray<double>& res_change);
   void UpdateResource(cAvidaContext& ctx, int id, double change);
@@ -422,7 +430,7 @@ private:
   cPopulationCell& PositionDemeRandom(int deme_id, cPopulationCell& parent_cell, bool parent_ok = true);
   int UpdateEmptyCellIDArray(int deme_id = -1);
   tArray<int>& GetEmptyCellIDArray() { return empty_cell_id_array; }
-  void FindEmptyCell(tList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
+  void FindEmptyCell(const cCellConnections& cell_list, tList<cPopulationCell>& found_list);
   int FindRandEmptyCell();
   
   // Update statistics collecting...
@@ -40,6 +40,7 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
 : m_world(in_cell.m_world)
 , m_organism(in_cell.m_organism)
 , m_hardware(in_cell.m_hardware)
+, m_connections(in_cell.m_connections)
 , m_inputs(in_cell.m_inputs)
 , m_cell_id(in_cell.m_cell_id)
 , m_deme_id(in_cell.m_deme_id)
@@ -52,11 +53,6 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
   // Copy the mutation rates into a new structure
   m_mut_rates = new cMutationRates(*in_cell.m_mut_rates);
 	
-  // Copy the connection list
-  tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-  cPopulationCell* test_cell;
-  while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
-	
 	// copy the hgt information, if needed.
 	if(in_cell.m_hgt) {
 		InitHGTSupport();
@@ -84,10 +80,8 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 		else
 			m_mut_rates->Copy(*in_cell.m_mut_rates);
 		
-		// Copy the connection list
-		tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-		cPopulationCell* test_cell;
-		while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
+		// Share the connections (they live in the population's neighbor table)
+		m_connections = in_cell.m_connections;
 		
 		// copy hgt information, if needed.
 		delete m_hgt;
@@ -147,10 +141,9 @@ void cPopulationCell::GetNeighboringCells(std::set<cPopulationCell*>& cell_set,
 	typedef std::set<cPopulationCell*> cell_set_t;
   
   // For each cell in our connection list...
-  tConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
+  for (int i = 0; i < m_connections.GetSize(); i++) {
 		// store the cell pointer, and check to see if we've already visited that cell...
-    cPopulationCell* cell = i.Next();
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell != 0); // cells should never be null.
 		std::pair<cell_set_t::iterator, bool> ins = cell_set.insert(cell);
 		// and if so, recurse to it...
@@ -178,9 +171,8 @@ void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>&
   occupied_cells.Resize(m_connections.GetSize());
   int occupied_count = 0;
 
-  tLWConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-    cPopulationCell* cell = i.Next();
+  for (int i = 0; i < m_connections.GetSize(); i++) {
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell); // cells should never be null.
     if (cell->IsOccupied()) occupied_cells[occupied_count++] = cell;
   }
@@ -39,6 +39,9 @@
 #ifndef tList_h
 #include "tList.h"
 #endif
+#ifndef cNeighborTable_h
+#include "cNeighborTable.h"
+#endif
 #include "cGenomeUtil.h"
 
 class cHardwareBase;
@@ -60,7 +63,7 @@ private:
   cOrganism* m_organism;                    // The occupent of this cell.
   cHardwareBase* m_hardware;
 
-  tList<cPopulationCell> m_connections;  // A list of neighboring cells.
+  cCellConnections m_connections;        // Neighboring cells, in the population's cNeighborTable.
   cMutationRates* m_mut_rates;           // Mutation rates at this cell.
   tArray<int> m_inputs;                 // Environmental Inputs...
 
@@ -111,7 +114,8 @@ public:
 
   inline cOrganism* GetOrganism() const { return m_organism; }
   inline cHardwareBase* GetHardware() const { return m_hardware; }
-  inline tList<cPopulationCell>& ConnectionList() { return m_connections; }
+  inline cCellConnections& ConnectionList() { return m_connections; }
+  inline const cCellConnections& ConnectionList() const { return m_connections; }
   //! Recursively build a set of cells that neighbor this one, out to the given depth.
   void GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const;
   //! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
@@ -224,4 +228,18 @@ inline int cPopulationCell::GetInputAt(int& input_pointer)
   return m_inputs[input_pointer++];
 }
 
+
+inline cPopulationCell* cCellConnections::GetFirst() const
+{
+  return (m_size) ? &m_cells[m_row[m_facing]] : NULL;
+}
+
+inline cPopulationCell* cCellConnections::GetPos(int pos) const
+{
+  if (pos >= m_size) return NULL;
+  int idx = m_facing + pos;
+  if (idx >= m_size) idx -= m_size;
+  return &m_cells[m_row[idx]];
+}
+
 #endif
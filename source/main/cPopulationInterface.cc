@@ -271,10 +271,9 @@ void cPopulationInterface::GetNeighborhoodCellIDs(tArray<int>& list)
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
   
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  const cCellConnections& conn_list = cell.ConnectionList();
+  list.Resize(conn_list.GetSize());
+  for (int i = 0; i < conn_list.GetSize(); i++) list[i] = conn_list.GetPos(i)->GetID();
 }
 
 int cPopulationInterface::GetFacing()
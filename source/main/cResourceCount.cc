@@ -22,6 +22,7 @@
 
 #include "cResourceCount.h"
 #include "cResource.h"
+#include "cResourceUpdateQueue.h"
 #include "cDynamicCount.h"
 #include "cGradientCount.h"
 #include "cWorld.h"
@@ -103,6 +104,9 @@ cResourceCount::cResourceCount(int num_resources)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_shared_time(NULL)
+  , m_shared_time_seen(0.0)
+  , m_update_queue(NULL)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -111,7 +115,11 @@ cResourceCount::cResourceCount(int num_resources)
   return;
 }
 
-cResourceCount::cResourceCount(const cResourceCount &rc) {
+cResourceCount::cResourceCount(const cResourceCount &rc)
+  : m_shared_time(NULL)
+  , m_shared_time_seen(0.0)
+  , m_update_queue(NULL)
+{
   *this = rc;
 
   return;
@@ -134,6 +142,10 @@ const cResourceCount &cResourceCount::operator=(const cResourceCount &rc) {
   
   curr_grid_res_cnt = rc.curr_grid_res_cnt;
   curr_spatial_res_cnt = rc.curr_spatial_res_cnt;
+  
+  // Pick up any time still pending on the source's shared clock; this count keeps its own clock (if any)
+  rc.syncSharedTime();
+  if (m_shared_time) m_shared_time_seen = *m_shared_time;
   update_time = rc.update_time;
   spatial_update_time = rc.spatial_update_time;
   cell_lists = rc.cell_lists;
@@ -335,6 +347,7 @@ void cResourceCount::Setup(cWorld* world, const int& res_index, const cString& n
   geometry[res_index] = in_geometry;
   spatial_resource_count[res_index]->SetGeometry(in_geometry);
   spatial_resource_count[res_index]->SetPointers();
+  spatial_resource_count[res_index]->SetElementFlow(world->GetConfig().SPATIAL_RES_FLOW_METHOD.Get() == 1);
   spatial_resource_count[res_index]->SetCellList(in_cell_list_ptr);
 
   double step_decay = pow(decay, UPDATE_STEP);
@@ -537,6 +550,22 @@ void cResourceCount::Update(double in_time)
   spatial_update_time += in_time;
  }
 
+// Attach to a clock that the owner advances in place of calling Update().  Time is pulled from the clock lazily,
+// whenever the resources are next brought up to date.
+void cResourceCount::SetSharedTime(const double* shared_time)
+{
+  syncSharedTime();
+  m_shared_time = shared_time;
+  m_shared_time_seen = (shared_time) ? *shared_time : 0.0;
+}
+
+// Collect pending time from the shared clock in preparation for the owner resetting it to zero
+void cResourceCount::FlushSharedTime()
+{
+  syncSharedTime();
+  m_shared_time_seen = 0.0;
+}
+
  
 const tArray<double> & cResourceCount::GetResources(cAvidaContext& ctx) const 
 {
@@ -728,8 +757,19 @@ int cResourceCount::GetMaxUsedY(int res_id)
 }
 
 ///// Private Methods /////////
+void cResourceCount::syncSharedTime() const
+{
+  if (!m_shared_time) return;
+  
+  const double elapsed = *m_shared_time - m_shared_time_seen;
+  update_time += elapsed;
+  spatial_update_time += elapsed;
+  m_shared_time_seen = *m_shared_time;
+}
+
 void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
 { 
+  syncSharedTime();
   assert(update_time >= -EPSILON);
 
   // Determine how many update steps have progressed
@@ -761,23 +801,142 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   // If one (or more) complete update has occured update the spatial resources
   while (m_spatial_update > m_last_updated) {
     m_last_updated++;
+    if (m_update_queue) {
+      updateSpatialResourcesConcurrent(ctx);
+      continue;
+    }
     for (int i = 0; i < resource_count.GetSize(); i++) {
      if (geometry[i] != nGeometry::GLOBAL && geometry[i] != nGeometry::PARTIAL) {
-        spatial_resource_count[i]->UpdateCount(ctx);
-        spatial_resource_count[i]->Source(inflow_rate[i]);
-        spatial_resource_count[i]->Sink(decay_rate[i]);
-        if (spatial_resource_count[i]->GetCellListSize() > 0) {
-          spatial_resource_count[i]->CellInflow();
-          spatial_resource_count[i]->CellOutflow();
-        }
-        spatial_resource_count[i]->FlowAll();
-        spatial_resource_count[i]->StateAll();
+        updateSpatialResource(ctx, i);
         // BDB: resource_count[i] = spatial_resource_count[i]->SumAll();
       }
     }
   }
 }
 
+void cResourceCount::updateSpatialResource(cAvidaContext& ctx, int res_id) const
+{
+  spatial_resource_count[res_id]->UpdateCount(ctx);
+  flowSpatialResource(res_id);
+}
+
+// Everything after UpdateCount only touches the resource's own grid
+void cResourceCount::flowSpatialResource(int res_id) const
+{
+  cSpatialResCount* res = spatial_resource_count[res_id];
+  res->Source(inflow_rate[res_id]);
+  res->Sink(decay_rate[res_id]);
+  if (res->GetCellListSize() > 0) {
+    res->CellInflow();
+    res->CellOutflow();
+  }
+  res->FlowAll();
+  res->StateAll();
+}
+
+
+// Runs the flow passes of a batch of independent spatial resources, one resource per task
+class cSpatialResBatchJob : public cResourceUpdateJob
+{
+private:
+  const cResourceCount& m_rc;
+  const tArray<int>& m_batch;
+  
+public:
+  cSpatialResBatchJob(const cResourceCount& rc, const tArray<int>& batch) : m_rc(rc), m_batch(batch) { ; }
+  
+  void Run(int task) { m_rc.flowSpatialResource(m_batch[task]); }
+};
+
+// Runs one pass of the flat flow kernel of a single spatial resource, one band of rows per task
+class cSpatialResRowJob : public cResourceUpdateJob
+{
+public:
+  enum ePass { SNAPSHOT, COMPUTE, APPLY };
+
+private:
+  cSpatialResCount& m_res;
+  ePass m_pass;
+  int m_num_bands;
+  
+public:
+  cSpatialResRowJob(cSpatialResCount& res, int num_bands) : m_res(res), m_pass(SNAPSHOT), m_num_bands(num_bands) { ; }
+  
+  void SetPass(ePass pass) { m_pass = pass; }
+  
+  void Run(int task)
+  {
+    const int first_row = (task * m_res.GetY()) / m_num_bands;
+    const int end_row = ((task + 1) * m_res.GetY()) / m_num_bands;
+    switch (m_pass) {
+      case SNAPSHOT: m_res.FlowRowsBegin(first_row, end_row); break;
+      case COMPUTE:  m_res.FlowRowsCompute(first_row, end_row); break;
+      case APPLY:    m_res.FlowRowsApply(first_row, end_row); m_res.StateRows(first_row, end_row); break;
+    }
+  }
+};
+
+
+// Updates spatial resources on the update queue.  Runs of resources that update independently of the rest of the world
+// are processed together; any other resource is updated on its own, in order, exactly as in the serial path.
+void cResourceCount::updateSpatialResourcesConcurrent(cAvidaContext& ctx) const
+{
+  tArray<int> batch;
+  for (int i = 0; i < resource_count.GetSize(); i++) {
+    if (geometry[i] == nGeometry::GLOBAL || geometry[i] == nGeometry::PARTIAL) continue;
+    
+    if (spatial_resource_count[i]->UpdatesIndependently()) {
+      batch.Push(i);
+    } else {
+      updateSpatialBatch(ctx, batch);
+      batch.Resize(0);
+      updateSpatialResource(ctx, i);
+    }
+  }
+  updateSpatialBatch(ctx, batch);
+}
+
+void cResourceCount::updateSpatialBatch(cAvidaContext& ctx, const tArray<int>& batch) const
+{
+  if (batch.GetSize() == 0) return;
+  
+  for (int i = 0; i < batch.GetSize(); i++) spatial_resource_count[batch[i]]->UpdateCount(ctx);
+  
+  // With at least one resource per thread, update whole resources concurrently
+  const int num_threads = m_update_queue->GetNumThreads();
+  if (batch.GetSize() >= num_threads) {
+    cSpatialResBatchJob job(*this, batch);
+    m_update_queue->Execute(job, batch.GetSize());
+    return;
+  }
+  
+  // Otherwise split the flow and state passes of each resource into bands of rows
+  for (int b = 0; b < batch.GetSize(); b++) {
+    cSpatialResCount& res = *spatial_resource_count[batch[b]];
+    if (!res.CanFlowByRows()) {
+      flowSpatialResource(batch[b]);
+      continue;
+    }
+    
+    res.Source(inflow_rate[batch[b]]);
+    res.Sink(decay_rate[batch[b]]);
+    if (res.GetCellListSize() > 0) {
+      res.CellInflow();
+      res.CellOutflow();
+    }
+    
+    const int num_bands = (res.GetY() < 4 * num_threads) ? res.GetY() : 4 * num_threads;
+    cSpatialResRowJob job(res, num_bands);
+    if (res.HasFlow()) {
+      m_update_queue->Execute(job, num_bands);
+      job.SetPass(cSpatialResRowJob::COMPUTE);
+      m_update_queue->Execute(job, num_bands);
+    }
+    job.SetPass(cSpatialResRowJob::APPLY);
+    m_update_queue->Execute(job, num_bands);
+  }
+}
+
 void cResourceCount::ReinitializeResources(cAvidaContext& ctx, double additional_resource)
 {
   for(int i = 0; i < resource_name.GetSize(); i++) {
@@ -35,6 +35,7 @@
 #include "tArrayMap.h"
 #endif
 
+class cResourceUpdateQueue;
 class cWorld;
 
 class cResourceCount
@@ -61,7 +62,21 @@ private:
   mutable int m_last_updated;
   mutable int m_spatial_update;
 
+  // Optional clock shared by many resource counts (i.e. demes), so elapsed time can be recorded once per step
+  const double* m_shared_time;
+  mutable double m_shared_time_seen;
+  
+  // Optional thread pool used to update spatial resources concurrently
+  cResourceUpdateQueue* m_update_queue;
+
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
+  void syncSharedTime() const;
+  void updateSpatialResource(cAvidaContext& ctx, int res_id) const;
+  void flowSpatialResource(int res_id) const;
+  void updateSpatialResourcesConcurrent(cAvidaContext& ctx) const;
+  void updateSpatialBatch(cAvidaContext& ctx, const tArray<int>& batch) const;
+  
+  friend class cSpatialResBatchJob;
 
   // A few constants to describe update process...
   static const double UPDATE_STEP;   // Fraction of an update per step
@@ -130,6 +145,9 @@ public:
   void SetDecay(const cString& name, const double _decay);
   
   void Update(double in_time);
+  void SetSharedTime(const double* shared_time);
+  void SetUpdateQueue(cResourceUpdateQueue* queue) { m_update_queue = queue; }
+  void FlushSharedTime();
 
   int GetSize(void) const { return resource_count.GetSize(); }
   const tArray<double>& ReadResources(void) const { return resource_count; }
@@ -0,0 +1,93 @@
+/*
+ *  cResourceUpdateQueue.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cResourceUpdateQueue.h"
+
+#include "cResourceUpdateWorker.h"
+
+
+cResourceUpdateQueue::cResourceUpdateQueue(int num_threads)
+: m_job(NULL), m_num_tasks(0), m_next_task(0), m_pending(0), m_pass(0), m_terminate(false)
+{
+  // The calling thread participates in every job, so only spawn the additional workers
+  if (num_threads > 1) {
+    m_workers.Resize(num_threads - 1);
+    for (int i = 0; i < m_workers.GetSize(); i++) {
+      m_workers[i] = new cResourceUpdateWorker(this);
+      m_workers[i]->Start();
+    }
+  }
+}
+
+cResourceUpdateQueue::~cResourceUpdateQueue()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+  
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+}
+
+
+void cResourceUpdateQueue::Execute(cResourceUpdateJob& job, int num_tasks)
+{
+  if (num_tasks <= 0) return;
+  
+  // Run small jobs on the calling thread rather than waking the pool
+  if (num_tasks == 1 || m_workers.GetSize() == 0) {
+    for (int i = 0; i < num_tasks; i++) job.Run(i);
+    return;
+  }
+  
+  m_mutex.Lock();
+  m_job = &job;
+  m_num_tasks = num_tasks;
+  m_next_task = 0;
+  m_pending = m_workers.GetSize();
+  m_pass++;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+  
+  runTasks(&job);
+  
+  // Wait for all workers to finish with the job
+  m_mutex.Lock();
+  while (m_pending > 0) m_done_cond.Wait(m_mutex);
+  m_job = NULL;
+  m_mutex.Unlock();
+}
+
+
+void cResourceUpdateQueue::runTasks(cResourceUpdateJob* job)
+{
+  while (true) {
+    m_mutex.Lock();
+    const int task = m_next_task++;
+    m_mutex.Unlock();
+    
+    if (task >= m_num_tasks) break;
+    job->Run(task);
+  }
+}
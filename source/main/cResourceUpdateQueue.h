@@ -0,0 +1,79 @@
+/*
+ *  cResourceUpdateQueue.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cResourceUpdateQueue_h
+#define cResourceUpdateQueue_h
+
+#include "apto/core.h"
+
+#include "tArray.h"
+
+class cResourceUpdateWorker;
+
+
+// cResourceUpdateJob - a unit of resource update work split into independently executable tasks
+
+class cResourceUpdateJob
+{
+public:
+  virtual ~cResourceUpdateJob() { ; }
+  
+  virtual void Run(int task) = 0;
+};
+
+
+// cResourceUpdateQueue - a pool of worker threads that runs all of the tasks of a job and returns once every task has
+// completed.  The calling thread works through tasks alongside the pool.
+
+class cResourceUpdateQueue
+{
+  friend class cResourceUpdateWorker;
+
+private:
+  tArray<cResourceUpdateWorker*> m_workers;
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_work_cond;
+  Apto::ConditionVariable m_done_cond;
+
+  cResourceUpdateJob* volatile m_job;
+  volatile int m_num_tasks;
+  volatile int m_next_task;   // next task to be claimed from the current job
+  volatile int m_pending;     // count of workers still processing the current job
+  volatile int m_pass;        // incremented to wake workers for a new job
+  volatile bool m_terminate;
+  
+  
+  void runTasks(cResourceUpdateJob* job);
+  
+  cResourceUpdateQueue(); // @not_implemented
+  cResourceUpdateQueue(const cResourceUpdateQueue&); // @not_implemented
+  cResourceUpdateQueue& operator=(const cResourceUpdateQueue&); // @not_implemented
+  
+public:
+  cResourceUpdateQueue(int num_threads);
+  ~cResourceUpdateQueue();
+  
+  int GetNumThreads() const { return m_workers.GetSize() + 1; }
+  
+  void Execute(cResourceUpdateJob& job, int num_tasks);
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ *  cResourceUpdateWorker.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cResourceUpdateWorker.h"
+
+#include "cResourceUpdateQueue.h"
+
+
+void cResourceUpdateWorker::Run()
+{
+  int last_pass = 0;
+  
+  while (1) {
+    m_queue->m_mutex.Lock();
+    while (m_queue->m_pass == last_pass && !m_queue->m_terminate) {
+      m_queue->m_work_cond.Wait(m_queue->m_mutex);
+    }
+    if (m_queue->m_terminate) {
+      m_queue->m_mutex.Unlock();
+      break;
+    }
+    last_pass = m_queue->m_pass;
+    cResourceUpdateJob* job = m_queue->m_job;
+    m_queue->m_mutex.Unlock();
+    
+    m_queue->runTasks(job);
+    
+    m_queue->m_mutex.Lock();
+    int pending = --m_queue->m_pending;
+    m_queue->m_mutex.Unlock();
+    if (!pending) m_queue->m_done_cond.Signal();
+  }
+}
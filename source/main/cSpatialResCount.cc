@@ -33,7 +33,7 @@ using namespace AvidaTools;
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry, double inxdiffuse, double inydiffuse,
                                    double inxgravity, double inygravity)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false), m_element_flow(false)
 {
   int i;
  
@@ -55,7 +55,7 @@ cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry,
 /* Setup a single spatial resource using default flow amounts  */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false), m_element_flow(false)
 {
   int i;
  
@@ -74,7 +74,8 @@ cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry)
    SetPointers();
 }
 
-cSpatialResCount::cSpatialResCount() : m_initial(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0), m_modified(false)
+cSpatialResCount::cSpatialResCount()
+: m_initial(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0), m_modified(false), m_element_flow(false)
 {
   geometry = nGeometry::GLOBAL;
 }
@@ -147,6 +148,15 @@ void cSpatialResCount::SetPointers()
       grid[ii].SetPtr(4, -99, -99, -99, -99.0);
     }
   }
+  
+  /* Mirror the flowing half of the neighbor links into the flat kernel planes */
+  
+  m_flow_nbr.ResizeClear(4 * num_cells);
+  m_flow_amount.ResizeClear(num_cells);
+  m_flow.ResizeClear(4 * num_cells);
+  for (int k = 0; k < 4; k++) {
+    for (i = 0; i < num_cells; i++) m_flow_nbr[k * num_cells + i] = grid[i].GetElemPtr(k + 3);
+  }
 }
 
 
@@ -318,6 +328,12 @@ void cSpatialResCount::FlowAll() {
   // @JEB save time if diffusion and gravity off...
   if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
 
+  if (m_element_flow) flowAllElements();
+  else flowAllGrid();
+}
+
+void cSpatialResCount::flowAllElements() {
+
   int     i,k,ii,xdist,ydist;
   double  dist;
  
@@ -339,6 +355,132 @@ void cSpatialResCount::FlowAll() {
   }
 }
 
+
+/* Amount of flow between two cells, following FlowMatter operation for operation so that both paths produce
+   identical results.  The direction is fixed at compile time, letting the stencil loops below vectorize. */
+
+template <int XDIST, int YDIST>
+static inline double FlowAmount(double amount1, double amount2, double inxdiffuse, double inydiffuse,
+                                double inxgravity, double inygravity, double dist)
+{
+  double xgravity, xdiffuse, ygravity, ydiffuse;
+  
+  const double diff = (amount1 - amount2);
+  if (XDIST != 0) {
+    if (((XDIST>0) && (inxgravity>0.0)) || ((XDIST<0) && (inxgravity<0.0))) {
+      xgravity = amount1 * fabs(inxgravity)/3.0;
+    } else {
+      xgravity = -amount2 * fabs(inxgravity)/3.0;
+    }
+    xdiffuse = inxdiffuse * diff / 16.0;
+  } else {
+    xdiffuse = 0.0;
+    xgravity = 0.0;
+  }
+  if (YDIST != 0) {
+    if (((YDIST>0) && (inygravity>0.0)) || ((YDIST<0) && (inygravity<0.0))) {
+      ygravity = amount1 * fabs(inygravity)/3.0;
+    } else {
+      ygravity = -amount2 * fabs(inygravity)/3.0;
+    }
+    ydiffuse = inydiffuse * diff / 16.0;
+  } else {
+    ydiffuse = 0.0;
+    ygravity = 0.0;
+  }
+  
+  return ((xdiffuse + ydiffuse + xgravity + ygravity)/
+          (fabs(XDIST*1.0) + fabs(YDIST*1.0)))/dist;
+}
+
+void cSpatialResCount::flowAllGrid() {
+  FlowRowsBegin(0, world_y);
+  FlowRowsCompute(0, world_y);
+  FlowRowsApply(0, world_y);
+}
+
+/* The flat flow kernel is split into three passes over a range of rows so that a large grid can be handed out to
+   several threads.  Each pass must be completed for the whole grid before the next one begins. */
+
+/* Snapshot the current amounts of the cells in the given rows */
+
+void cSpatialResCount::FlowRowsBegin(int first_row, int end_row) {
+  for (int i = first_row * world_x; i < end_row * world_x; i++) m_flow_amount[i] = grid[i].GetAmount();
+}
+
+/* Compute the flow across every east, southeast, south and southwest link leaving the given rows.  Rows and columns
+   wrap as in a torus; links that do not exist in a bounded grid are computed but never applied. */
+
+void cSpatialResCount::FlowRowsCompute(int first_row, int end_row) {
+  if (!HasFlow()) return;
+
+  const double SQRT2 = sqrt(2.0);
+  const double* amount = m_flow_amount.begin();
+  double* flow_e = m_flow.begin();
+  double* flow_se = flow_e + num_cells;
+  double* flow_s = flow_se + num_cells;
+  double* flow_sw = flow_s + num_cells;
+  
+  for (int y = first_row; y < end_row; y++) {
+    const double* row = amount + y * world_x;
+    const double* below = amount + ((y + 1) % world_y) * world_x;
+    const int offset = y * world_x;
+    const int last = world_x - 1;
+    
+    for (int x = 0; x < last; x++) {
+      flow_e[offset + x] = FlowAmount<1, 0>(row[x], row[x + 1], xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+      flow_se[offset + x] = FlowAmount<1, 1>(row[x], below[x + 1], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    }
+    flow_e[offset + last] = FlowAmount<1, 0>(row[last], row[0], xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+    flow_se[offset + last] = FlowAmount<1, 1>(row[last], below[0], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    
+    for (int x = 0; x < world_x; x++) {
+      flow_s[offset + x] = FlowAmount<0, 1>(row[x], below[x], xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+    }
+    
+    flow_sw[offset] = FlowAmount<-1, 1>(row[0], below[last], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    for (int x = 1; x < world_x; x++) {
+      flow_sw[offset + x] = FlowAmount<-1, 1>(row[x], below[x - 1], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    }
+  }
+}
+
+/* Apply the computed flows to the deltas of the cells in the given rows.  Links only join a row to itself and to the
+   row below, so these cells receive flow from their own rows and from the row above (for row 0 that is the last row,
+   which a full pass visits last).  Visiting those source rows in grid order gives every cell its flows in exactly the
+   order of the per-element path. */
+
+void cSpatialResCount::FlowRowsApply(int first_row, int end_row) {
+  if (!HasFlow()) return;
+
+  applyFlowRows((first_row > 0) ? first_row - 1 : 0, end_row, first_row, end_row);
+  if (first_row == 0 && end_row < world_y) applyFlowRows(world_y - 1, world_y, first_row, end_row);
+}
+
+void cSpatialResCount::applyFlowRows(int src_first_row, int src_end_row, int first_row, int end_row) {
+  const int* nbr = m_flow_nbr.begin();
+  const double* flow = m_flow.begin();
+  const int first_cell = first_row * world_x;
+  const int end_cell = end_row * world_x;
+  
+  for (int i = src_first_row * world_x; i < src_end_row * world_x; i++) {
+    const bool src_in_range = (i >= first_cell && i < end_cell);
+    for (int k = i; k < 4 * num_cells; k += num_cells) {
+      const int ii = nbr[k];
+      if (ii >= 0) {
+        if (src_in_range) grid[i].Rate(-flow[k]);
+        if (ii >= first_cell && ii < end_cell) grid[ii].Rate(flow[k]);
+      }
+    }
+  }
+}
+
+/* Fold the rate variable into the resource state for the cells in the given rows */
+
+void cSpatialResCount::StateRows(int first_row, int end_row) {
+  for (int i = first_row * world_x; i < end_row * world_x; i++) grid[i].State();
+}
+
 /* Total up all the resources in each cell */
 
 double cSpatialResCount::SumAll() const{
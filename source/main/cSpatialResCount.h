@@ -56,6 +56,17 @@ private:
   tArray<cCellResource> *cell_list_ptr;
   bool m_modified;
   
+  // Flat flow kernel state.  Neighbor ids and flows are stored as planes of num_cells entries, one plane for each of
+  // the east, southeast, south and southwest neighbors (pointers 3 through 6 of cSpatialCountElem).
+  bool m_element_flow;
+  tArray<int> m_flow_nbr;
+  tArray<double> m_flow_amount;
+  tArray<double> m_flow;
+  
+  void flowAllElements();
+  void flowAllGrid();
+  void applyFlowRows(int src_first_row, int src_end_row, int first_row, int end_row);
+  
 public:
   cSpatialResCount();
   cSpatialResCount(int inworld_x, int inworld_y, int ingeometry);
@@ -82,6 +93,13 @@ public:
   void RateAll(double ratein); 
   virtual void StateAll();
   void FlowAll(); 
+  bool HasFlow() const { return (xdiffuse != 0.0) || (ydiffuse != 0.0) || (xgravity != 0.0) || (ygravity != 0.0); }
+  bool CanFlowByRows() const { return !m_element_flow; }
+  void FlowRowsBegin(int first_row, int end_row);
+  void FlowRowsCompute(int first_row, int end_row);
+  void FlowRowsApply(int first_row, int end_row);
+  void StateRows(int first_row, int end_row);
+  virtual bool UpdatesIndependently() const { return true; }
   double SumAll() const;
   void Source(double amount) const;
   void CellInflow() const;
@@ -95,6 +113,7 @@ public:
   void SetXgravity(double in_xgravity) { xgravity = in_xgravity; }
   void SetYdiffuse(double in_ydiffuse) { ydiffuse = in_ydiffuse; }
   void SetYgravity(double in_ygravity) { ygravity = in_ygravity; }
+  void SetElementFlow(bool in_element_flow) { m_element_flow = in_element_flow; }
   void SetInflowX1(int in_inflowX1) { inflowX1 = in_inflowX1; }
   void SetInflowX2(int in_inflowX2) { inflowX2 = in_inflowX2; }
   void SetInflowY1(int in_inflowY1) { inflowY1 = in_inflowY1; }
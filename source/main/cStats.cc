@@ -58,6 +58,7 @@ using namespace AvidaTools;
 cStats::cStats(cWorld* world)
   : m_world(world)
   , m_data_manager(this, "population_data")
+  , m_bound_table(NULL)
   , m_update(-1)
   , avida_time(0)
   , rave_true_replication_rate( 500 )
@@ -337,7 +338,12 @@ Data::ConstDataSetPtr cStats::Provides() const
 
 void cStats::UpdateProvidedValues(Update current_update)
 {
-  // Nothing for now, all handled by ProcessUpdate()
+  // Statistics themselves are all handled by ProcessUpdate(), only bound values need to be stored
+  for (int i = 0; i < m_bound_data.GetSize(); i++) {
+    const BoundData& bound = m_bound_data[i];
+    if (bound.data.type == Data::VALUE_INT) m_bound_table->SetInt(bound.slot, (this->*bound.data.int_func)());
+    else m_bound_table->SetDouble(bound.slot, (this->*bound.data.double_func)());
+  }
 }
 
 Data::PackagePtr cStats::GetProvidedValue(const Apto::String& data_id) const
@@ -363,6 +369,24 @@ Apto::String cStats::DescribeProvidedValue(const Apto::String& data_id) const
 }
 
 
+bool cStats::BindProvidedValue(const Apto::String& data_id, Data::ValueTable& table)
+{
+  ProvidedData data_entry;
+  if (!m_provided_data.Get(data_id, data_entry)) return false;
+  
+  assert(!m_bound_table || m_bound_table == &table);
+  m_bound_table = &table;
+  m_bound_data.Push(BoundData(table.AddValue(data_id, data_entry.type), data_entry));
+  return true;
+}
+
+void cStats::UnbindProvidedValues()
+{
+  m_bound_table = NULL;
+  m_bound_data.Resize(0);
+}
+
+
 template <class T> Data::PackagePtr cStats::packageData(T (cStats::*func)() const) const
 {
   return Data::PackagePtr(new Data::Wrap<T>((this->*func)()));
@@ -382,7 +406,7 @@ void cStats::setupProvidedData()
 
   // Define PROVIDE macro to simplify instantiating new provided data
 #define PROVIDE(name, desc, type, func) { \
-  m_provided_data[name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, &cStats::func));\
+  m_provided_data[name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, &cStats::func), &cStats::func);\
   mgr.Register(name, activate); \
 }
   
@@ -4647,9 +4671,9 @@ void cStats::PrintMiniTraceReactions(cOrganism* org)
 
   std::ofstream& fp = df.GetOFStream();
   
-  tArray<int> reaction_count = org->GetPhenotype().GetCurReactionCount();
-  tArray<int> reaction_cycles = org->GetPhenotype().GetFirstReactionCycles();
-  tArray<int> reaction_execs = org->GetPhenotype().GetFirstReactionExecs();
+  const tArraySlice<int>& reaction_count = org->GetPhenotype().GetCurReactionCount();
+  const tArraySlice<int>& reaction_cycles = org->GetPhenotype().GetFirstReactionCycles();
+  const tArraySlice<int>& reaction_execs = org->GetPhenotype().GetFirstReactionExecs();
   
   fp << org->GetID() << " " << org->GetPhenotype().GetUpdateBorn() << " ";
   for (int i = 0; i < reaction_count.GetSize() - 1; i++) {
@@ -4700,7 +4724,7 @@ void cStats::UpdateTopNavTrace(cOrganism* org)
   // 'best' org is the one among the orgs with the highest reaction achieved that reproduced in the least number of cycles
   // using cycles, so any inst executions in parallel multi-threads are only counted as one exec
   int best_reac = -1;
-  tArray<int> reaction_count = org->GetPhenotype().GetCurReactionCount();
+  const tArraySlice<int>& reaction_count = org->GetPhenotype().GetCurReactionCount();
   for (int i = reaction_count.GetSize() -1; i >= 0; i--) {
     if (reaction_count[i] > 0) {
       best_reac = i;
@@ -4742,8 +4766,8 @@ void cStats::UpdateTopNavTrace(cOrganism* org)
       topnavtraceupdate[i] = traceupdate[i];
     }
     
-    tArray<int> reaction_cycles = org->GetPhenotype().GetFirstReactionCycles();
-    tArray<int> reaction_execs = org->GetPhenotype().GetFirstReactionExecs();
+    const tArraySlice<int>& reaction_cycles = org->GetPhenotype().GetFirstReactionCycles();
+    const tArraySlice<int>& reaction_execs = org->GetPhenotype().GetFirstReactionExecs();
     
     topreactioncycles.Resize(reaction_cycles.GetSize());
     topreactioncycles.SetAll(-1);
@@ -4846,7 +4870,7 @@ void cStats::PrintReproData(cOrganism* org)
   std::ofstream& fp = df.GetOFStream();
   fp << update << " " << org->GetBioGroup("genotype")->GetID()<< " " << org->GetID() << " " << org->GetPhenotype().GetAge() << " " << org->GetPhenotype().GetTimeUsed() 
       << " " << org->GetPhenotype().GetNumExecs() << " ";
-  tArray<int> reaction_count = org->GetPhenotype().GetCurReactionCount();
+  const tArraySlice<int>& reaction_count = org->GetPhenotype().GetCurReactionCount();
   for (int i = 0; i < reaction_count.GetSize() - 1; i++) {
     fp << reaction_count[i] << ",";
   }
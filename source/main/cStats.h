@@ -111,13 +111,30 @@ private:
   {
     Apto::String description;
     Apto::Functor<Data::PackagePtr, Apto::NullType> GetData;
+    Data::ValueType type;
+    int (cStats::*int_func)() const;
+    double (cStats::*double_func)() const;
     
-    ProvidedData() { ; }
-    ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func)
-      : description(desc), GetData(func) { ; } 
+    ProvidedData() : int_func(NULL), double_func(NULL) { ; }
+    ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func, int (cStats::*value)() const)
+      : description(desc), GetData(func), type(Data::VALUE_INT), int_func(value), double_func(NULL) { ; }
+    ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func, double (cStats::*value)() const)
+      : description(desc), GetData(func), type(Data::VALUE_DOUBLE), int_func(NULL), double_func(value) { ; }
   };
   Apto::Map<Apto::String, ProvidedData> m_provided_data;
   mutable Data::ConstDataSetPtr m_provides;
+  
+  // Values bound to slots of the data manager's value table, written on every UpdateProvidedValues()
+  struct BoundData
+  {
+    Data::ValueSlot slot;
+    ProvidedData data;
+    
+    BoundData() : slot(-1) { ; }
+    BoundData(Data::ValueSlot in_slot, const ProvidedData& in_data) : slot(in_slot), data(in_data) { ; }
+  };
+  Data::ValueTable* m_bound_table;
+  Apto::Array<BoundData> m_bound_data;
 
 
   // --------  Time scales  ---------
@@ -444,6 +461,8 @@ public:
   void UpdateProvidedValues(Update current_update);
   Data::PackagePtr GetProvidedValue(const Apto::String& data_id) const;
   Apto::String DescribeProvidedValue(const Apto::String& data_id) const;
+  bool BindProvidedValue(const Apto::String& data_id, Data::ValueTable& table);
+  void UnbindProvidedValues();
   
   // cStats
   void ProcessUpdate();
@@ -774,6 +793,7 @@ public:
 
 
   void AddSpeculative(int spec) { m_spec_total += spec; m_spec_num++; }
+  void AddSpeculative(int spec_total, int spec_num) { m_spec_total += spec_total; m_spec_num += spec_num; }
   void AddSpeculativeWaste(int waste) { m_spec_waste += waste; }
 
   // Sexual selection recording
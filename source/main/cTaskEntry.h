@@ -44,11 +44,14 @@ private:
   int m_id;
   tTaskTest m_test_fun;
   cArgContainer* m_args;
+  bool m_has_logic_mask;
+  unsigned int m_logic_mask[8];  // Bit per logic id (0-255) for tasks that depend only on the logic id
 
 public:
   cTaskEntry(const cString& name, const cString& desc, int in_id, tTaskTest fun, cArgContainer* args)
-    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args)
+    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args), m_has_logic_mask(false)
   {
+    for (int i = 0; i < 8; i++) m_logic_mask[i] = 0;
   }
   ~cTaskEntry()
   {
@@ -62,6 +65,19 @@ public:
   
   bool HasArguments() const { return (m_args != NULL); }
   cArgContainer& GetArguments() const { return *m_args; }
+
+  bool HasLogicMask() const { return m_has_logic_mask; }
+  void SetLogicMask(const unsigned int mask[8])
+  {
+    for (int i = 0; i < 8; i++) m_logic_mask[i] = mask[i];
+    m_has_logic_mask = true;
+  }
+  inline bool MatchesLogicId(int logic_id) const
+  {
+    // Inconsistent outputs are flagged with a negative logic id, and match no logic task
+    if (logic_id < 0) return false;
+    return (m_logic_mask[logic_id >> 5] >> (logic_id & 31)) & 1;
+  }
 };
 
 #endif
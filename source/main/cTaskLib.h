@@ -61,7 +61,7 @@ private:
   {
     REQ_NEIGHBOR_INPUT=1,
     REQ_NEIGHBOR_OUTPUT=2, 
-    UNUSED_REQ_C=4,
+    REQ_LOGIC_ID_ONLY=4,
     UNUSED_REQ_D=8
   };
   
@@ -80,7 +80,12 @@ public:
   cTaskEntry * GetTaskReference(int id) { return task_array[id]; }
 
   void SetupTests(cTaskContext& ctx) const;
-  inline double TestOutput(cTaskContext& ctx) const { return (this->*(ctx.GetTaskEntry()->GetTestFun()))(ctx); }
+  inline double TestOutput(cTaskContext& ctx) const
+  {
+    const cTaskEntry* entry = ctx.GetTaskEntry();
+    if (entry->HasLogicMask()) return entry->MatchesLogicId(ctx.GetLogicId()) ? 1.0 : 0.0;
+    return (this->*(entry->GetTestFun()))(ctx);
+  }
 
   bool UseNeighborInput() const { return use_neighbor_input; }
   bool UseNeighborOutput() const { return use_neighbor_output; }
@@ -39,6 +39,7 @@
 #include "cPopulation.h"
 #include "cStats.h"
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cUserFeedback.h"
 
 #include <cassert>
@@ -48,7 +49,7 @@ using namespace AvidaTools;
 
 cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
   : m_working_dir(wd), m_analyze(NULL), m_conf(cfg), m_ctx(this, m_rng), m_class_mgr(NULL), m_datafile_mgr(NULL)
-  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL),m_mig_mat(NULL), m_pop(NULL), m_stats(NULL), m_driver(NULL), m_data_mgr(NULL)   // MIGRATION_MATRIX
+  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL),m_mig_mat(NULL), m_pop(NULL), m_stats(NULL), m_test_cache(NULL), m_driver(NULL), m_data_mgr(NULL)   // MIGRATION_MATRIX
 {
 }
 
@@ -74,6 +75,7 @@ cWorld::~cWorld()
   delete m_env; m_env = NULL;
   delete m_event_list; m_event_list = NULL;
   delete m_hw_mgr; m_hw_mgr = NULL;
+  delete m_test_cache; m_test_cache = NULL;
 
   // Delete after all classes that may be logging items
   if (m_datafile_mgr) { m_datafile_mgr->FlushAll(); }
@@ -103,6 +105,8 @@ bool cWorld::setup(cUserFeedback* feedback)
   m_srng.ResetSeed(m_conf->RANDOM_SEED.Get());
   
   m_datafile_mgr = new cDataFileManager(cString(Apto::FileSystem::GetAbsolutePath(Apto::String(m_conf->DATA_DIR.Get()), Apto::String(m_working_dir))), (m_conf->VERBOSITY.Get() > VERBOSE_ON));
+  if (m_conf->DATA_FILE_BUFFERED.Get()) m_datafile_mgr->EnableBuffering(m_conf->DATA_FILE_QUEUE_SIZE.Get());
+  if (m_conf->DATA_FILE_FORMAT.Get() == 1) m_datafile_mgr->EnableColumnar();
   
   m_data_mgr = new Avida::Data::Manager(this);
   
@@ -156,6 +160,9 @@ bool cWorld::setup(cUserFeedback* feedback)
   // If there were errors loading at this point, it is perilous to try to go further (pop depends on an instruction set)
   if (!success) return success;
   
+  // Test CPU results are cached once the environment and instruction sets they depend on are loaded
+  if (m_conf->TEST_CACHE.Get()) m_test_cache = new cTestResultCache(this, feedback);
+  
   
   // @MRR CClade Tracking
 //	if (m_conf->TRACK_CCLADES.Get() > 0)
@@ -49,6 +49,7 @@ class cMerit;
 class cPopulationCell;
 class cStats;
 class cTestCPU;
+class cTestResultCache;
 class cUserFeedback;
 template<class T> class tDataEntry;
 template<class T> class tDictionary;
@@ -72,6 +73,7 @@ protected:
   cMigrationMatrix* m_mig_mat;  // MIGRATION_MATRIX
   cPopulation* m_pop;
   Apto::SmartPtr<cStats, Apto::ThreadSafeRefCount> m_stats;
+  cTestResultCache* m_test_cache;
   WorldDriver* m_driver;
   
   Avida::Data::Manager* m_data_mgr;
@@ -113,6 +115,7 @@ public:
   cRandom& GetRandom() { return m_rng; } 
   cRandom& GetRandomSample() { return m_srng; }
   cStats& GetStats() { return *m_stats; }
+  cTestResultCache* GetTestResultCache() { return m_test_cache; }  // NULL unless TEST_CACHE is set
   WorldDriver& GetDriver() { return *m_driver; }
   
   Data::Manager& GetDataManager() { return *m_data_mgr; }
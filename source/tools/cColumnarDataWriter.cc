@@ -0,0 +1,194 @@
+/*
+ *  cColumnarDataWriter.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cColumnarDataWriter.h"
+
+#include <cstring>
+
+using namespace std;
+
+
+static inline void appendLE(string& buf, unsigned long long value, int bytes)
+{
+  for (int b = 0; b < bytes; b++) buf += (char)((value >> (8 * b)) & 0xFF);
+}
+
+static inline void padTo8(string& buf)
+{
+  while (buf.size() % 8) buf += '\0';
+}
+
+
+cColumnarDataWriter::cColumnarDataWriter(streambuf* out)
+  : m_out(out), m_has_schema(false), m_block_rows(0), m_row_size(0), m_row_changed(false)
+{
+  string preamble("AVDF");
+  appendLE(preamble, FORMAT_VERSION, 4);
+  m_out->sputn(preamble.data(), preamble.size());
+}
+
+
+cColumnarDataWriter::uValue& cColumnarDataWriter::addCell(int type, bool anonymous, const char* name)
+{
+  const int idx = m_row_size++;
+
+  // The first cell that differs from the current schema starts a new one, seeded with the columns that matched
+  if (!m_row_changed && (idx >= (int)m_schema.size() || m_schema[idx].type != type || m_schema[idx].anonymous != anonymous)) {
+    m_row_changed = true;
+    m_row_schema.assign(m_schema.begin(), m_schema.begin() + idx);
+  }
+  if (m_row_changed) m_row_schema.push_back(sColumn(type, anonymous, name));
+
+  if ((int)m_row_values.size() < m_row_size) m_row_values.resize(m_row_size);
+  return m_row_values[idx];
+}
+
+
+void cColumnarDataWriter::AddString(const char* value, const char* name, bool anonymous)
+{
+  uValue& cell = addCell(TYPE_STRING, anonymous, name);
+  cell.i = m_row_strings.size();
+  m_row_strings.push_back(value);
+}
+
+
+void cColumnarDataWriter::EndRow()
+{
+  if (!m_row_changed && (m_row_size != (int)m_schema.size() || !m_has_schema)) {
+    m_row_changed = true;
+    m_row_schema.assign(m_schema.begin(), m_schema.begin() + m_row_size);
+  }
+
+  if (m_row_changed) {
+    FlushBlock();
+    m_schema.swap(m_row_schema);
+    m_has_schema = true;
+    m_columns.clear();
+    m_columns.resize(m_schema.size());
+    writeSchema();
+  }
+
+  for (int c = 0; c < m_row_size; c++) {
+    sColumnData& col = m_columns[c];
+    const uValue& value = m_row_values[c];
+    switch (m_schema[c].type) {
+      case TYPE_INT32:
+      case TYPE_UINT32:
+        appendLE(col.data, (unsigned long long)value.i, 4);
+        break;
+      case TYPE_INT64:
+        appendLE(col.data, (unsigned long long)value.i, 8);
+        break;
+      case TYPE_FLOAT64:
+        {
+          unsigned long long bits;
+          memcpy(&bits, &value.d, sizeof(bits));
+          appendLE(col.data, bits, 8);
+        }
+        break;
+      case TYPE_STRING:
+        col.data += m_row_strings[value.i];
+        appendLE(col.offsets, col.data.size(), 4);
+        break;
+    }
+  }
+  m_block_rows++;
+
+  m_row_size = 0;
+  m_row_changed = false;
+  m_row_schema.clear();
+  m_row_strings.clear();
+
+  if (m_block_rows == BLOCK_ROWS) FlushBlock();
+}
+
+
+void cColumnarDataWriter::WriteText(const string& text)
+{
+  if (text.empty()) return;
+
+  // Keep the text in order with the rows written before it
+  FlushBlock();
+  writeText(RECORD_TEXT, text);
+}
+
+
+void cColumnarDataWriter::FlushBlock()
+{
+  if (m_block_rows == 0) return;
+
+  string payload;
+  appendLE(payload, m_block_rows, 4);
+  appendLE(payload, m_schema.size(), 4);
+  for (unsigned int c = 0; c < m_schema.size(); c++) {
+    sColumnData& col = m_columns[c];
+    if (m_schema[c].type == TYPE_STRING) {
+      appendLE(payload, 0, 4);
+      payload += col.offsets;
+      padTo8(payload);
+    }
+    payload += col.data;
+    padTo8(payload);
+    col.data.clear();
+    col.offsets.clear();
+  }
+  m_block_rows = 0;
+
+  writeRecord(RECORD_BLOCK, payload);
+}
+
+
+void cColumnarDataWriter::writeRecord(int type, const string& payload)
+{
+  string record;
+  appendLE(record, type, 4);
+  appendLE(record, payload.size(), 4);
+  m_out->sputn(record.data(), record.size());
+  m_out->sputn(payload.data(), payload.size());
+}
+
+
+void cColumnarDataWriter::writeText(int type, const string& text)
+{
+  string payload;
+  appendLE(payload, text.size(), 4);
+  appendLE(payload, 0, 4);
+  payload += text;
+  padTo8(payload);
+  writeRecord(type, payload);
+}
+
+
+void cColumnarDataWriter::writeSchema()
+{
+  string payload;
+  appendLE(payload, m_schema.size(), 4);
+  appendLE(payload, 0, 4);
+  for (unsigned int c = 0; c < m_schema.size(); c++) {
+    appendLE(payload, m_schema[c].type, 1);
+    appendLE(payload, m_schema[c].anonymous ? FLAG_ANONYMOUS : 0, 1);
+    const unsigned int name_size = (m_schema[c].name.size() < 0xFFFF) ? m_schema[c].name.size() : 0xFFFF;
+    appendLE(payload, name_size, 2);
+    payload.append(m_schema[c].name, 0, name_size);
+  }
+  padTo8(payload);
+  writeRecord(RECORD_SCHEMA, payload);
+}
@@ -0,0 +1,118 @@
+/*
+ *  cColumnarDataWriter.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cColumnarDataWriter_h
+#define cColumnarDataWriter_h
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+
+// Binary columnar encoding of cDataFile rows.
+//
+// A file is the 8 byte preamble "AVDF" + format version, followed by records.  Every record is a 32-bit type and a
+// 32-bit payload length, then the payload padded to a multiple of 8 bytes, so all column arrays are 8 byte aligned
+// when the file is memory mapped.  Records are only ever appended.  All integers are little-endian.
+//
+//   HEADER  text the text format writes ahead of the first row (#filetype, #format, comments and column legend)
+//   SCHEMA  column count, then per column: type (8 bits), flags (8 bits), name length (16 bits), name
+//   BLOCK   row count, column count, then each column as a contiguous array; strings are an array of row count + 1
+//           byte offsets followed by the characters
+//   TEXT    raw text written outside of typed columns, reproduced verbatim
+//
+// HEADER and TEXT payloads start with the 32-bit text length and 32 reserved bits.  A SCHEMA applies to every BLOCK
+// that follows it until the next SCHEMA.
+class cColumnarDataWriter
+{
+public:
+  enum eRecord { RECORD_HEADER = 1, RECORD_SCHEMA = 2, RECORD_BLOCK = 3, RECORD_TEXT = 4 };
+  enum eType { TYPE_INT32 = 1, TYPE_INT64 = 2, TYPE_UINT32 = 3, TYPE_FLOAT64 = 4, TYPE_STRING = 5 };
+  enum eFlags { FLAG_ANONYMOUS = 1 };
+
+  static const unsigned int FORMAT_VERSION = 1;
+  static const int BLOCK_ROWS = 1024;
+
+private:
+  struct sColumn
+  {
+    int type;
+    bool anonymous;
+    std::string name;
+
+    sColumn(int in_type, bool in_anonymous, const char* in_name) : type(in_type), anonymous(in_anonymous), name(in_name) { ; }
+  };
+
+  struct sColumnData
+  {
+    std::string data;
+    std::string offsets;   // string columns only
+  };
+
+  union uValue
+  {
+    long long i;
+    double d;
+  };
+
+  std::streambuf* m_out;
+
+  std::vector<sColumn> m_schema;
+  bool m_has_schema;
+  std::vector<sColumnData> m_columns;
+  int m_block_rows;
+
+  // The row being assembled.  The schema is only copied for a row that does not match the current one.
+  int m_row_size;
+  bool m_row_changed;
+  std::vector<sColumn> m_row_schema;
+  std::vector<uValue> m_row_values;
+  std::vector<std::string> m_row_strings;
+
+
+  cColumnarDataWriter(); // @not_implemented
+  cColumnarDataWriter(const cColumnarDataWriter&); // @not_implemented
+  cColumnarDataWriter& operator=(const cColumnarDataWriter&); // @not_implemented
+
+  uValue& addCell(int type, bool anonymous, const char* name);
+  void writeRecord(int type, const std::string& payload);
+  void writeText(int type, const std::string& text);
+  void writeSchema();
+
+public:
+  cColumnarDataWriter(std::streambuf* out);
+
+  void AddInt(int value, const char* name, bool anonymous = false) { addCell(TYPE_INT32, anonymous, name).i = value; }
+  void AddLong(long value, const char* name, bool anonymous = false) { addCell(TYPE_INT64, anonymous, name).i = value; }
+  void AddUInt(unsigned int value, const char* name) { addCell(TYPE_UINT32, false, name).i = value; }
+  void AddDouble(double value, const char* name, bool anonymous = false) { addCell(TYPE_FLOAT64, anonymous, name).d = value; }
+  void AddString(const char* value, const char* name, bool anonymous = false);
+
+  void EndRow();
+
+  void WriteHeader(const std::string& text) { writeText(RECORD_HEADER, text); }
+  void WriteText(const std::string& text);
+
+  // Writes out all complete rows that are still held in the current block
+  void FlushBlock();
+};
+
+#endif
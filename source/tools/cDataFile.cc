@@ -22,6 +22,8 @@
 
 #include "cDataFile.h"
 
+#include "cColumnarDataWriter.h"
+#include "cDataFileWriter.h"
 #include "cStringUtil.h"
 
 #include <cstdio>
@@ -30,17 +32,47 @@
 using namespace std;
 
 
-cDataFile::cDataFile(cString& name) : m_name(name), m_descr_written(false), m_num_cols(0)
+cDataFile::cDataFile(cString& name, cDataFileWriter* writer, bool columnar)
+  : m_name(name), m_descr_written(false), m_num_cols(0), m_buf(NULL)
+  , m_mode(columnar ? OUTPUT_UNDECIDED : OUTPUT_TEXT), m_columns(NULL), m_file_buf(NULL)
 {
-  m_fp.open(name);
+  if (writer) {
+    // Route the stream through an in-memory buffer owned by this file; the ofstream's own file buffer stays unused
+    m_buf = new cBufferedFileBuf(*writer, name);
+    static_cast<std::ostream&>(m_fp).rdbuf(m_buf);
+    if (!m_buf->IsOpen()) m_fp.setstate(std::ios::failbit);
+  } else {
+    m_fp.open(name);
+  }
   assert(m_fp.good());
   m_descr_written = false;
 }
 
+cDataFile::~cDataFile()
+{
+  if (m_columns) {
+    flushText();
+    m_columns->FlushBlock();
+    delete m_columns;
+    static_cast<std::ostream&>(m_fp).rdbuf(m_file_buf);
+  }
+  
+  if (m_buf) {
+    m_buf->Close();
+    static_cast<std::ostream&>(m_fp).rdbuf(NULL);
+    delete m_buf;
+  } else {
+    m_fp.close();
+  }
+}
+
 
 void cDataFile::Write(double x, const char* descr, const char* format)
 {
-  if (!m_descr_written) {
+  if (useColumns()) {
+    m_columns->AddDouble(x, descr);
+    WriteColumnDesc(descr, format);
+  } else if (!m_descr_written) {
     m_data << x << " ";
     WriteColumnDesc(descr, format);
   } else {
@@ -51,7 +83,10 @@ void cDataFile::Write(double x, const char* descr, const char* format)
 
 void cDataFile::Write(int i, const char* descr, const char* format)
 {
-  if (!m_descr_written) {
+  if (useColumns()) {
+    m_columns->AddInt(i, descr);
+    WriteColumnDesc(descr, format);
+  } else if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr, format);
   } else {
@@ -62,7 +97,10 @@ void cDataFile::Write(int i, const char* descr, const char* format)
 
 void cDataFile::Write(long i, const char* descr, const char* format)
 {
-  if (!m_descr_written) {
+  if (useColumns()) {
+    m_columns->AddLong(i, descr);
+    WriteColumnDesc(descr, format);
+  } else if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr, format);
   } else {
@@ -72,7 +110,10 @@ void cDataFile::Write(long i, const char* descr, const char* format)
 
 void cDataFile::Write(unsigned int i, const char* descr, const char* format)
 {
-  if (!m_descr_written) {
+  if (useColumns()) {
+    m_columns->AddUInt(i, descr);
+    WriteColumnDesc(descr);
+  } else if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr);
   } else {
@@ -83,7 +124,10 @@ void cDataFile::Write(unsigned int i, const char* descr, const char* format)
 
 void cDataFile::Write(const char* data_str, const char* descr, const char* format)
 {
-  if (!m_descr_written) {
+  if (useColumns()) {
+    m_columns->AddString(data_str, descr);
+    WriteColumnDesc(descr, format);
+  } else if (!m_descr_written) {
     m_data << data_str << " ";
     WriteColumnDesc(descr, format);
   } else {
@@ -94,7 +138,10 @@ void cDataFile::Write(const char* data_str, const char* descr, const char* forma
 void cDataFile::Write(tArray<int> list, const char* descr, const char* format)
 {
     //Anya is trying to make a commant to write vectors for Kaboom data
-    if (!m_descr_written) {
+    if (useColumns()) {
+        for (int i = 0; i < (int)list.GetSize(); i++) m_columns->AddInt(list[i], descr);
+        WriteColumnDesc(descr, format);
+    } else if (!m_descr_written) {
         for (int i=0; i< (int)list.GetSize();i++) {
             m_data << list[i] << " ";
         }
@@ -107,14 +154,41 @@ void cDataFile::Write(tArray<int> list, const char* descr, const char* format)
 }
 
 
+void cDataFile::WriteAnonymous(double x)
+{
+  if (useColumns()) m_columns->AddDouble(x, "", true);
+  else m_fp << x << " ";
+}
+
+void cDataFile::WriteAnonymous(int i)
+{
+  if (useColumns()) m_columns->AddInt(i, "", true);
+  else m_fp << i << " ";
+}
+
+void cDataFile::WriteAnonymous(long i)
+{
+  if (useColumns()) m_columns->AddLong(i, "", true);
+  else m_fp << i << " ";
+}
+
+void cDataFile::WriteAnonymous(const char* data_str)
+{
+  if (useColumns()) m_columns->AddString(data_str, "", true);
+  else m_fp << data_str << " ";
+}
+
+
 void cDataFile::WriteBlockElement(double x, int element, int x_size)
 {
+  useText();
   m_fp << x << " ";
   if (((element + 1) % x_size) == 0) m_fp << "\n";
 }
 
 void cDataFile::WriteBlockElement(int i, int element, int x_size)
 {
+  useText();
   m_fp << i << " ";
   if (((element + 1) % x_size) == 0) m_fp << "\n";
 }
@@ -142,6 +216,7 @@ void cDataFile::WriteRawComment(const char* comment)
 
 void cDataFile::WriteRaw(const char* str)
 {
+  useText();
   m_fp << cStringUtil::Stringf( "%s\n", str);
 }
 
@@ -158,6 +233,7 @@ void cDataFile::WriteTimeStamp()
 
 void cDataFile::FlushComments()
 {
+  useText();
   if (!m_descr_written) {
     m_fp << m_descr;
     m_descr = "";
@@ -170,6 +246,25 @@ void cDataFile::FlushComments()
 
 void cDataFile::Endl()
 {
+  if (useColumns()) {
+    // Raw text written since the last row comes before this one
+    flushText();
+    
+    if (!m_descr_written) {
+      // The header is stored exactly as the text format would print it
+      cString header;
+      if (m_filetype != "") header += cString("#filetype ") + m_filetype + "\n";
+      if (m_format != "") header += cString("#format ") + m_format + "\n";
+      header += m_descr + "\n";
+      m_columns->WriteHeader(std::string(header, header.GetSize()));
+      m_descr = "";
+      m_descr_written = true;
+    }
+    
+    m_columns->EndRow();
+    return;
+  }
+  
   if (!m_descr_written) {
     // Handle filetype and format first
     if (m_filetype != "") m_fp << "#filetype " << m_filetype << endl;
@@ -189,3 +284,37 @@ void cDataFile::Endl()
     m_fp << endl;
   }
 }
+
+
+void cDataFile::Flush()
+{
+  if (m_columns) {
+    flushText();
+    m_columns->FlushBlock();
+    if (!m_buf) m_file_buf->pubsync();
+  }
+  
+  if (m_buf) m_buf->Flush();
+  else m_fp.flush();
+}
+
+
+void cDataFile::startColumns()
+{
+  m_mode = OUTPUT_COLUMNAR;
+  
+  // Columns go straight to the file, while anything written to m_fp is collected as text
+  m_file_buf = static_cast<std::ostream&>(m_fp).rdbuf();
+  static_cast<std::ostream&>(m_fp).rdbuf(&m_text_buf);
+  m_columns = new cColumnarDataWriter(m_file_buf);
+}
+
+
+void cDataFile::flushText()
+{
+  const std::string text = m_text_buf.str();
+  if (text.empty()) return;
+  
+  m_columns->WriteText(text);
+  m_text_buf.str("");
+}
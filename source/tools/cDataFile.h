@@ -35,6 +35,9 @@
 #include "cString.h"
 #endif
 
+class cBufferedFileBuf;
+class cColumnarDataWriter;
+class cDataFileWriter;
 
 
 // This class encapsulates output file handling for the class cDataFileManager.
@@ -53,16 +56,30 @@ private:
   int m_num_cols;
   
   std::ofstream m_fp;
+  cBufferedFileBuf* m_buf;   // replaces the stream's file buffer when output goes through a cDataFileWriter
+
+  // Columnar files stay undecided until their first output, and fall back to text if that output bypasses the typed
+  // Write methods.  Once columnar, m_fp collects any raw text, which is stored in order between rows.
+  enum eOutputMode { OUTPUT_TEXT, OUTPUT_UNDECIDED, OUTPUT_COLUMNAR };
+  eOutputMode m_mode;
+  cColumnarDataWriter* m_columns;
+  std::streambuf* m_file_buf;
+  std::stringbuf m_text_buf;
 
   
   cDataFile();
   cDataFile(const cDataFile&); // @not_implemented.
   cDataFile& operator=(const cDataFile&); // @not_implemented
 
+  inline void useText() { if (m_mode == OUTPUT_UNDECIDED) m_mode = OUTPUT_TEXT; }
+  inline bool useColumns() { if (m_mode == OUTPUT_UNDECIDED) startColumns(); return (m_mode == OUTPUT_COLUMNAR); }
+  void startColumns();
+  void flushText();
+
   
 public:
-  cDataFile(cString& name);
-  ~cDataFile() { m_fp.close(); }
+  cDataFile(cString& name, cDataFileWriter* writer = NULL, bool columnar = false);
+  ~cDataFile();
 
   inline const cString& GetName() const { return m_name; }
   inline const cString& GetFileType() const { return m_filetype; }
@@ -73,7 +90,7 @@ public:
   inline bool SetFileType(const cString& ft);
   
 
-  std::ofstream& GetOFStream() { return m_fp; }
+  std::ofstream& GetOFStream() { useText(); return m_fp; }
 
   
   // The following methods output a value into the data file.
@@ -91,10 +108,10 @@ public:
   
   // The following methods output a value into the data file anonymously (no column descriptor).
   //  first argument (x, i, data_str, etc.) - the value to write (as double, int, const char *, etc.)
-  inline void WriteAnonymous(double x) { m_fp << x << " "; }
-  inline void WriteAnonymous(int i) { m_fp << i << " "; }
-  inline void WriteAnonymous(long i) { m_fp << i << " "; }
-  inline void WriteAnonymous(const char* data_str) { m_fp << data_str << " "; }
+  void WriteAnonymous(double x);
+  void WriteAnonymous(int i);
+  void WriteAnonymous(long i);
+  void WriteAnonymous(const char* data_str);
   
   
   // The following methods are useful for outputting tables of values with row size x
@@ -130,7 +147,8 @@ public:
   void Endl();
 
   
-  void Flush() { m_fp.flush(); }
+  // Write all data to disk; for buffered files this hands the pending output to the writer thread
+  void Flush();
 };
 
 inline bool cDataFile::SetFileType(const cString& ft)
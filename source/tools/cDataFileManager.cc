@@ -12,10 +12,12 @@
 
 #include "apto/core/FileSystem.h"
 
+#include "cDataFileWriter.h"
+
 using namespace std;
 
 
-cDataFileManager::cDataFileManager(const cString& target_dir, bool verbose) : m_target_dir(target_dir)
+cDataFileManager::cDataFileManager(const cString& target_dir, bool verbose) : m_target_dir(target_dir), m_writer(NULL), m_columnar(false)
 {
   m_target_dir.Trim();
   
@@ -35,6 +37,14 @@ cDataFileManager::~cDataFileManager()
   m_datafiles.AsLists(names, files);
   tListIterator<cDataFile*> list_it(files);
   while (list_it.Next() != NULL) delete *list_it.Get();
+  
+  // All files are closed, so nothing remains queued for the writer
+  delete m_writer;
+}
+
+void cDataFileManager::EnableBuffering(int queue_blocks)
+{
+  if (!m_writer) m_writer = new cDataFileWriter(queue_blocks);
 }
 
 cDataFile& cDataFileManager::Get(const cString& name)
@@ -91,7 +101,7 @@ cDataFile& cDataFileManager::Get(const cString& name)
   }
 
   target = dir_prefix + target;
-  found_file = new cDataFile(target);
+  found_file = new cDataFile(target, m_writer, m_columnar);
   m_datafiles.Set(name, found_file);
 
   return *found_file;
@@ -27,6 +27,7 @@
  **/
 
 class cDataFile;
+class cDataFileWriter;
 class cString;
 template <class T> class tList; // aggregate
 
@@ -35,6 +36,8 @@ class cDataFileManager
 private:
   cString m_target_dir;
   tDictionary<cDataFile*> m_datafiles;
+  cDataFileWriter* m_writer;
+  bool m_columnar;
 
   cDataFileManager(const cDataFileManager&); // @not_implemented
   cDataFileManager& operator=(const cDataFileManager&); // @not_implemented
@@ -51,6 +54,17 @@ public:
    * @param name The name of the file to look up/create.
    **/
   cDataFile& Get(const cString & name);
+
+  /** Buffers the output of files opened from now on in memory and writes it from a background thread. At most
+   * queue_blocks filled blocks wait for the writer before output stalls. Buffered files only reach disk as blocks
+   * fill, on FlushAll(), and when they are closed.
+   **/
+  void EnableBuffering(int queue_blocks);
+
+  /** Files opened from now on are written in the binary columnar format (see @ref cColumnarDataWriter). Files whose
+   * first output is raw text rather than typed columns are still written as text.
+   **/
+  void EnableColumnar() { m_columnar = true; }
   std::ofstream& GetOFStream(const cString& name) { return Get(name).GetOFStream(); }
 
   inline bool IsOpen(const cString& name);
@@ -0,0 +1,177 @@
+/*
+ *  cDataFileWriter.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cDataFileWriter.h"
+
+
+cDataFileWriter::cDataFileWriter(int max_queued_blocks)
+: m_head(0), m_count(0), m_busy(false), m_terminate(false), m_num_free(0)
+{
+  if (max_queued_blocks < 1) max_queued_blocks = 1;
+  m_queue.Resize(max_queued_blocks);
+
+  // Every block is either queued, held by the writer, or owned by a file, so the free list never needs to hold more
+  // than the queue plus the one in progress
+  m_free_blocks.Resize(max_queued_blocks + 1);
+
+  Start();
+}
+
+cDataFileWriter::~cDataFileWriter()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+  m_work_cond.Signal();
+  Join();
+
+  for (int i = 0; i < m_num_free; i++) delete [] m_free_blocks[i];
+}
+
+
+char* cDataFileWriter::AcquireBlock()
+{
+  m_mutex.Lock();
+  char* block = (m_num_free) ? m_free_blocks[--m_num_free] : NULL;
+  m_mutex.Unlock();
+
+  if (!block) block = new char[BLOCK_SIZE];
+  return block;
+}
+
+
+void cDataFileWriter::Submit(FILE* fp, char* block, int size, bool flush)
+{
+  m_mutex.Lock();
+  while (m_count == m_queue.GetSize()) m_space_cond.Wait(m_mutex);
+
+  sRequest& req = m_queue[(m_head + m_count) % m_queue.GetSize()];
+  req.fp = fp;
+  req.block = block;
+  req.size = size;
+  req.flush = flush;
+  m_count++;
+  m_mutex.Unlock();
+
+  m_work_cond.Signal();
+}
+
+
+void cDataFileWriter::Sync()
+{
+  m_mutex.Lock();
+  while (m_count > 0 || m_busy) m_idle_cond.Wait(m_mutex);
+  m_mutex.Unlock();
+}
+
+
+void cDataFileWriter::Run()
+{
+  while (true) {
+    m_mutex.Lock();
+    while (m_count == 0 && !m_terminate) m_work_cond.Wait(m_mutex);
+
+    // Termination only happens once all files have been closed, which drains the queue
+    if (m_count == 0) {
+      m_mutex.Unlock();
+      break;
+    }
+
+    sRequest req = m_queue[m_head];
+    m_head = (m_head + 1) % m_queue.GetSize();
+    m_count--;
+    m_busy = true;
+    m_mutex.Unlock();
+    m_space_cond.Signal();
+
+    if (req.size) fwrite(req.block, 1, req.size, req.fp);
+    if (req.flush) fflush(req.fp);
+
+    m_mutex.Lock();
+    if (req.block) {
+      if (m_num_free < m_free_blocks.GetSize()) m_free_blocks[m_num_free++] = req.block;
+      else delete [] req.block;
+    }
+    m_busy = false;
+    const bool idle = (m_count == 0);
+    m_mutex.Unlock();
+    if (idle) m_idle_cond.Broadcast();
+  }
+}
+
+
+cBufferedFileBuf::cBufferedFileBuf(cDataFileWriter& writer, const char* filename)
+: m_writer(writer), m_fp(fopen(filename, "w")), m_block(NULL)
+{
+  if (m_fp) {
+    m_block = m_writer.AcquireBlock();
+    setp(m_block, m_block + cDataFileWriter::BLOCK_SIZE);
+  }
+}
+
+
+void cBufferedFileBuf::handoff(bool flush)
+{
+  const int size = pptr() - pbase();
+  if (size == 0 && !flush) return;
+
+  if (size) {
+    m_writer.Submit(m_fp, m_block, size, flush);
+    m_block = m_writer.AcquireBlock();
+    setp(m_block, m_block + cDataFileWriter::BLOCK_SIZE);
+  } else {
+    m_writer.Submit(m_fp, NULL, 0, flush);
+  }
+}
+
+
+int cBufferedFileBuf::overflow(int c)
+{
+  if (!m_fp) return traits_type::eof();
+
+  handoff(false);
+  if (c != traits_type::eof()) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+
+void cBufferedFileBuf::Flush()
+{
+  if (m_fp) handoff(true);
+}
+
+
+void cBufferedFileBuf::Close()
+{
+  if (!m_fp) return;
+
+  handoff(false);
+  m_writer.Sync();
+  fclose(m_fp);
+  m_fp = NULL;
+
+  delete [] m_block;
+  m_block = NULL;
+  setp(NULL, NULL);
+}
@@ -0,0 +1,114 @@
+/*
+ *  cDataFileWriter.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cDataFileWriter_h
+#define cDataFileWriter_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+
+#include <cstdio>
+#include <streambuf>
+
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+
+
+// Background writer thread for buffered data files.  Filled output blocks are handed to the writer through a bounded
+// queue; when the queue is full the submitting thread waits for the writer to catch up.
+class cDataFileWriter : public Apto::Thread
+{
+public:
+  static const int BLOCK_SIZE = 65536;
+
+private:
+  struct sRequest
+  {
+    FILE* fp;
+    char* block;   // NULL for a flush with no pending data
+    int size;
+    bool flush;
+  };
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_work_cond;
+  Apto::ConditionVariable m_space_cond;
+  Apto::ConditionVariable m_idle_cond;
+
+  tArray<sRequest> m_queue;     // ring buffer of pending requests
+  int m_head;
+  int m_count;
+  bool m_busy;
+  bool m_terminate;
+
+  tArray<char*> m_free_blocks;
+  int m_num_free;
+
+
+  cDataFileWriter(); // @not_implemented
+  cDataFileWriter(const cDataFileWriter&); // @not_implemented
+  cDataFileWriter& operator=(const cDataFileWriter&); // @not_implemented
+
+  void Run();
+
+public:
+  cDataFileWriter(int max_queued_blocks);
+  ~cDataFileWriter();
+
+  // Returns an empty block of BLOCK_SIZE bytes, reusing blocks the writer has finished with
+  char* AcquireBlock();
+
+  // Queues size bytes of block for writing to fp, after which the writer owns the block.  When flush is set, fp is
+  // flushed once everything queued before it has been written.
+  void Submit(FILE* fp, char* block, int size, bool flush);
+
+  // Waits until every queued request has been written
+  void Sync();
+};
+
+
+// Stream buffer that collects a data file's output in writer blocks.  Stream level flushes (e.g. std::endl) are
+// ignored; data only moves to the writer when a block fills or the file is explicitly flushed or closed.
+class cBufferedFileBuf : public std::streambuf
+{
+private:
+  cDataFileWriter& m_writer;
+  FILE* m_fp;
+  char* m_block;
+
+  void handoff(bool flush);
+
+protected:
+  int overflow(int c);
+  int sync() { return 0; }
+
+public:
+  cBufferedFileBuf(cDataFileWriter& writer, const char* filename);
+  ~cBufferedFileBuf() { Close(); }
+
+  bool IsOpen() const { return m_fp != NULL; }
+
+  void Flush();
+  void Close();
+};
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ *  cFingerprint.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cFingerprint_h
+#define cFingerprint_h
+
+#ifndef cString_h
+#include "cString.h"
+#endif
+
+#include <cstring>
+
+
+// cFingerprint - a 64-bit hash of a sequence of values
+//
+// Values are folded in one at a time (FNV-1a over their bytes), so the same values added in the same order give the
+// same fingerprint on every run and platform of the same byte order.  Strings are length prefixed, so "ab","c" and
+// "a","bc" differ.
+class cFingerprint
+{
+private:
+  unsigned long long m_value;
+
+  inline void addBytes(const void* data, int size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (int i = 0; i < size; i++) {
+      m_value ^= bytes[i];
+      m_value *= 0x100000001B3ULL;
+    }
+  }
+
+public:
+  cFingerprint() : m_value(0xCBF29CE484222325ULL) { ; }
+
+  inline void Add(unsigned long long value) { addBytes(&value, sizeof(value)); }
+  inline void Add(int value) { addBytes(&value, sizeof(value)); }
+  inline void Add(double value) { unsigned long long bits; memcpy(&bits, &value, sizeof(bits)); Add(bits); }
+  inline void Add(const cString& str) { Add(str.GetSize()); addBytes(static_cast<const char*>(str), str.GetSize()); }
+
+  // Returns the fingerprint, with its bits mixed so that every value added affects all of them
+  inline unsigned long long GetValue() const
+  {
+    unsigned long long total = m_value;
+    total ^= total >> 33;
+    total *= 0xFF51AFD7ED558CCDULL;
+    total ^= total >> 33;
+    total *= 0xC4CEB9FE1A85EC53ULL;
+    total ^= total >> 33;
+    return total;
+  }
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ *  tArraySlice.h
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef tArraySlice_h
+#define tArraySlice_h
+
+#include "tArray.h"
+
+#include <cassert>
+
+
+// tArraySlice - a fixed-size run of elements stored in another container
+//
+// A slice behaves like a reference to its elements: constructing one binds it (to a tArray or to raw storage, see
+// Bind), while assigning to one copies elements into the storage it is bound to, as far as both sizes allow.  A
+// slice is never resized, and, as with tArray, a const slice only gives const access to its elements.
+template <class T> class tArraySlice
+{
+private:
+  T* m_data;  // Data Elements (not owned)
+  int m_size; // Number of Elements
+
+public:
+  typedef T* iterator;
+  typedef const T* const_iterator;
+
+  tArraySlice() : m_data(NULL), m_size(0) { ; }
+  tArraySlice(const tArraySlice& rhs) : m_data(rhs.m_data), m_size(rhs.m_size) { ; }
+  tArraySlice(const tArray<T>& arr) : m_data(const_cast<T*>(arr.begin())), m_size(arr.GetSize()) { ; }
+
+  // Binds the slice to the size elements starting at data, returning the position just past them
+  T* Bind(T* data, int size) { assert(size >= 0); m_data = data; m_size = size; return data + size; }
+
+  tArraySlice& operator=(const tArraySlice& rhs)
+  {
+    const int size = (m_size < rhs.m_size) ? m_size : rhs.m_size;
+    for (int i = 0; i < size; i++) m_data[i] = rhs.m_data[i];
+    return *this;
+  }
+
+  inline iterator begin() { return m_data; }
+  inline iterator end() { return m_data + m_size; }
+  inline const_iterator begin() const { return m_data; }
+  inline const_iterator end() const { return m_data + m_size; }
+
+  int GetSize() const { return m_size; }
+
+  T& operator[](const int index)
+  {
+    assert(index >= 0);     // Lower Bounds Error
+    assert(index < m_size); // Upper Bounds Error
+    return m_data[index];
+  }
+  const T& operator[](const int index) const
+  {
+    assert(index >= 0);     // Lower Bounds Error
+    assert(index < m_size); // Upper Bounds Error
+    return m_data[index];
+  }
+
+  void SetAll(const T& value)
+  {
+    for (int i = 0; i < m_size; i++) m_data[i] = value;
+  }
+
+  // Returns a copy of the elements, for callers that keep them beyond the life of the storage
+  tArray<T> AsArray() const
+  {
+    tArray<T> arr(m_size);
+    for (int i = 0; i < m_size; i++) arr[i] = m_data[i];
+    return arr;
+  }
+};
+
+#endif
@@ -0,0 +1,226 @@
+/*
+ *  avida-datconvert.cc
+ *  Avida
+ *
+ *  Created by David on 10/17/11.
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Converts data files written with DATA_FILE_FORMAT 1 (see cColumnarDataWriter.h) back to the text format.  Files
+// that are already text are copied unchanged.
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+enum { RECORD_HEADER = 1, RECORD_SCHEMA = 2, RECORD_BLOCK = 3, RECORD_TEXT = 4 };
+enum { TYPE_INT32 = 1, TYPE_INT64 = 2, TYPE_UINT32 = 3, TYPE_FLOAT64 = 4, TYPE_STRING = 5 };
+enum { FLAG_ANONYMOUS = 1 };
+
+static const unsigned int FORMAT_VERSION = 1;
+
+
+struct sColumn
+{
+  int type;
+  bool anonymous;
+  const unsigned char* data;
+  const unsigned char* offsets;
+};
+
+
+static unsigned long long readLE(const unsigned char* p, int bytes)
+{
+  unsigned long long value = 0;
+  for (int b = bytes - 1; b >= 0; b--) value = (value << 8) | p[b];
+  return value;
+}
+
+static unsigned int padded(unsigned int size)
+{
+  return (size + 7) & ~7u;
+}
+
+static void fail(const char* filename, const char* msg)
+{
+  cerr << "error: " << filename << ": " << msg << endl;
+  exit(1);
+}
+
+
+static void writeCell(ostream& out, const sColumn& col, int row)
+{
+  switch (col.type) {
+    case TYPE_INT32:   out << (int)readLE(col.data + 4 * row, 4); break;
+    case TYPE_UINT32:  out << (unsigned int)readLE(col.data + 4 * row, 4); break;
+    case TYPE_INT64:   out << (long long)readLE(col.data + 8 * row, 8); break;
+    case TYPE_FLOAT64:
+      {
+        unsigned long long bits = readLE(col.data + 8 * row, 8);
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        out << value;
+      }
+      break;
+    case TYPE_STRING:
+      {
+        const unsigned int start = readLE(col.offsets + 4 * row, 4);
+        const unsigned int end = readLE(col.offsets + 4 * (row + 1), 4);
+        out.write((const char*)col.data + start, end - start);
+      }
+      break;
+  }
+  out << " ";
+}
+
+
+static void convert(const char* filename, const string& buf, ostream& out)
+{
+  const unsigned char* base = (const unsigned char*)buf.data();
+  const unsigned int size = buf.size();
+
+  if (readLE(base + 4, 4) != FORMAT_VERSION) fail(filename, "unsupported format version");
+
+  vector<sColumn> schema;
+  string header;
+  bool header_pending = false;
+
+  unsigned int pos = 8;
+  while (pos + 8 <= size) {
+    const int type = readLE(base + pos, 4);
+    const unsigned int len = readLE(base + pos + 4, 4);
+    const unsigned char* payload = base + pos + 8;
+    if (len > size - pos - 8) fail(filename, "truncated record");
+    pos += 8 + len;
+
+    switch (type) {
+      case RECORD_HEADER:
+      case RECORD_TEXT:
+        {
+          const unsigned int text_len = readLE(payload, 4);
+          if (type == RECORD_TEXT) {
+            out.write((const char*)payload + 8, text_len);
+          } else {
+            header.assign((const char*)payload + 8, text_len);
+            header_pending = true;
+          }
+        }
+        break;
+
+      case RECORD_SCHEMA:
+        {
+          const unsigned int num_cols = readLE(payload, 4);
+          schema.resize(num_cols);
+          unsigned int offset = 8;
+          for (unsigned int c = 0; c < num_cols; c++) {
+            schema[c].type = payload[offset];
+            schema[c].anonymous = (payload[offset + 1] & FLAG_ANONYMOUS);
+            offset += 4 + readLE(payload + offset + 2, 2);
+          }
+        }
+        break;
+
+      case RECORD_BLOCK:
+        {
+          const int num_rows = readLE(payload, 4);
+          if (readLE(payload + 4, 4) != schema.size()) fail(filename, "block does not match schema");
+
+          // Locate each column array within the block
+          unsigned int offset = 8;
+          for (unsigned int c = 0; c < schema.size(); c++) {
+            sColumn& col = schema[c];
+            switch (col.type) {
+              case TYPE_INT32:
+              case TYPE_UINT32:
+                col.data = payload + offset;
+                offset += padded(4 * num_rows);
+                break;
+              case TYPE_INT64:
+              case TYPE_FLOAT64:
+                col.data = payload + offset;
+                offset += 8 * num_rows;
+                break;
+              case TYPE_STRING:
+                col.offsets = payload + offset;
+                offset += padded(4 * (num_rows + 1));
+                col.data = payload + offset;
+                offset += padded(readLE(col.offsets + 4 * num_rows, 4));
+                break;
+              default:
+                fail(filename, "unknown column type");
+            }
+          }
+          if (offset > len) fail(filename, "truncated block");
+
+          for (int r = 0; r < num_rows; r++) {
+            if (header_pending) {
+              // The text format writes anonymous values as they arrive, ahead of the header and the first row
+              for (unsigned int c = 0; c < schema.size(); c++) if (schema[c].anonymous) writeCell(out, schema[c], r);
+              out << header;
+              for (unsigned int c = 0; c < schema.size(); c++) if (!schema[c].anonymous) writeCell(out, schema[c], r);
+              header_pending = false;
+            } else {
+              for (unsigned int c = 0; c < schema.size(); c++) writeCell(out, schema[c], r);
+            }
+            out << "\n";
+          }
+        }
+        break;
+
+      default:
+        fail(filename, "unknown record type");
+    }
+  }
+
+  if (pos != size) fail(filename, "truncated record");
+}
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2 || argc > 3) {
+    cerr << "Usage: " << argv[0] << " [data_file] [output_file]" << endl
+         << "  [data_file] is a data file written with DATA_FILE_FORMAT 1." << endl
+         << "  [output_file] receives the text version (default: standard output)." << endl
+         << endl;
+    exit(1);
+  }
+
+  ifstream in(argv[1], ios::in | ios::binary);
+  if (!in) fail(argv[1], "unable to open file");
+  ostringstream contents;
+  contents << in.rdbuf();
+  const string buf = contents.str();
+
+  ofstream out_file;
+  if (argc == 3) {
+    out_file.open(argv[2], ios::out | ios::binary);
+    if (!out_file) fail(argv[2], "unable to open file");
+  }
+  ostream& out = (argc == 3) ? out_file : cout;
+
+  if (buf.size() >= 8 && buf.compare(0, 4, "AVDF") == 0) convert(argv[1], buf, out);
+  else out << buf;
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+deme_0000000_energy_0000000 = [ ...
+99490 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+
+deme_0000000_energy_0000010 = [ ...
+30815.8 30918 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 30815.8 
+0 0 0 0 0 0 0 0 0 30815.8 
+];
+
+deme_0000000_energy_0000020 = [ ...
+15770.3 15770.3 15804.5 0 0 0 0 15798.9 15770.3 0 
+20344 0 0 15820.4 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+15833.8 0 0 0 0 0 0 0 15770.3 15822.7 
+15770.3 15832.2 0 0 0 0 0 15770.3 15832.2 15770.3 
+];
+
+deme_0000000_energy_0000030 = [ ...
+13397.3 12474.1 15309.3 0 0 0 0 15275.8 12515.5 12533 
+19496.5 12474.1 12474.1 15341.1 0 0 0 12472.9 0 0 
+0 12474.1 12474.1 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+12004.7 0 0 0 0 0 0 0 12474.1 0 
+12043.3 13351 12519.2 0 0 0 0 0 12474.1 12526.8 
+12525.5 12515.5 0 0 0 0 0 13345.6 12474.1 12521.8 
+12534.3 13397.3 12474.1 0 0 0 0 13397.3 12521.8 13397.3 
+];
+
+deme_0000000_energy_0000040 = [ ...
+11806.3 11869 14795 11752 11752 0 11752 14752.7 11869 11869 
+18609.6 11793.3 11869 14744.2 11752 0 11861.8 11798.2 11869 11902.7 
+11752 11869 11799.2 0 0 0 11798.2 0 11942.5 11752 
+11798 11802.7 11814.8 11803.9 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 10996 0 
+11902.7 0 0 0 0 0 0 11793.3 12108 10957.5 
+11187.8 12947.3 11869 0 0 0 11789.8 11808.7 11752 11806.3 
+11801.6 11808.7 11869 11869 0 11869 11902.7 11869 11802.7 11808.7 
+11808.7 11869 11808.7 11805.7 0 0 12145.6 11752 11806.3 11869 
+];
+
+deme_0000000_energy_0000050 = [ ...
+11534.2 10581.8 14125.2 11621.1 11534.2 11492.5 11593.7 14072.7 11653.2 11533 
+17586.3 11156.4 11649.7 14090.3 11451.9 11534.2 11593.7 11525.7 11649.7 11534.2 
+11633.4 11649.7 11163.1 11653.2 11534.2 11525.7 11525.7 11527.3 11605.6 11407 
+11649.7 11593.7 11566.9 11646.5 11640.7 0 11527.3 11525.7 11605.6 11648.5 
+11534.2 11593.7 11489.7 11641.9 11634.9 0 0 11605.6 10729.7 11565.8 
+10702.5 11534.2 10726.5 0 11534.2 10645.3 10645.3 11593.7 10729.7 11566.9 
+11566.9 10726.5 11566.9 11534.2 11566.9 11630.2 11633.7 11632.2 11566.9 10767 
+10769.2 12476.9 11566.9 11566.9 11566.9 11566.9 11532.4 11566.9 11593.7 11534.2 
+10936.4 11566.9 11532.2 11566.9 11534.2 11534.2 11534.2 11534.2 11593.7 11593.7 
+11534.2 11566.9 11534.2 11532.2 11566.9 11534.2 11566.9 11565.8 11566.9 10937.5 
+];
+
+deme_0000000_energy_0000060 = [ ...
+11466.2 10652.3 10651.3 11242 11599.7 11559.1 11493.4 13445 11460.8 10180.8 
+11603.2 10812.8 11300.1 13507.7 11112.9 11460.8 11259.3 11493.4 11460.8 11059.6 
+10765.2 10812.8 10802 11349 11464.9 11462.2 11452.1 11570.1 11493.4 11102.3 
+11605.6 11482.4 10567.7 10569.8 11610.4 11604.6 11321.4 11553.8 11531.8 10802.3 
+11481.2 11460.8 11609.2 11493.4 11556.9 11610.2 11559.1 11553.8 11608.4 11607.2 
+10802.3 11603.4 10991 11493.4 11559.1 10079.3 11615.5 11559.1 11559.1 11600.9 
+10623 10183 11559.1 11460.8 11493.4 11595.3 11605.7 11493.4 11557.9 10917.9 
+10920.1 12006.6 10183 11486.4 10611.9 11460.8 11493.4 11493.4 11460.8 10623 
+11602.3 11611.6 11458.7 11458.7 11559.1 11586.3 10802.3 11559.1 11559.1 11604.6 
+11610.4 11493.4 11493.4 11611.4 11603.2 11559.1 10840.3 10802.3 11559.1 11460.8 
+];
+
+deme_0000000_energy_0000070 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+30114.3 0 0 0 0 0 0 0 0 0 
+30262.7 30114.3 0 0 0 0 0 0 0 30262.7 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000000_energy_0000080 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+14918.9 14996.9 0 0 0 0 0 0 0 14920.4 
+14969.9 14993.9 14977.4 0 0 0 0 0 19512.1 0 
+14993.9 14993.9 14975.9 0 0 0 0 0 14974.4 19577.6 
+14993.9 0 0 0 0 0 0 0 0 14974.4 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000000_energy_0000090 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 12334.5 
+12335.7 12333.3 0 0 0 0 0 0 11592.4 0 
+12332 14530.5 12533.8 0 0 0 0 0 12491.8 11592.4 
+12533.8 12533.8 11634.3 12063.8 0 0 0 11641.3 18779 11649.5 
+11649.5 12653.4 10949.3 11643.6 0 0 0 0 11640.1 12533.8 
+12071.5 12555.4 0 10940.5 0 0 0 0 11396 12569.4 
+0 0 0 0 0 0 0 11396 0 12102.2 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000000_energy_0000100 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+11744.4 10807 0 0 0 0 0 0 11061 11316.7 
+11706.8 10812.4 11764.8 0 0 0 0 10904.9 10863.4 11064.4 
+11706.8 11758.9 11023.3 11022.2 0 0 0 10906 10863.4 11761.6 
+11709.1 10990.9 11022.2 11025 11025 0 0 10863.4 12072.1 11022.2 
+11022.2 10202.4 10990.9 10228.3 10199.3 0 0 10901.6 17787.6 10990.9 
+10990.9 11477.5 10199.3 10990.9 10228.3 10229.3 0 10912.5 10978.5 11022.2 
+10233.1 12129.3 10674.6 10199.3 11022.2 0 10911.4 11004.2 11059 10990.9 
+10207.2 10233.1 10198.3 10674.6 0 0 0 11023.3 11022.2 10233.1 
+10233.1 0 0 0 0 0 0 0 11022.2 10267.3 
+];
+
@@ -0,0 +1,144 @@
+deme_0000001_energy_0000000 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+
+deme_0000001_energy_0000010 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000020 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000030 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000040 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000050 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000060 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000070 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 51714.2 0 0 0 0 0 0 0 0 
+30262.7 0 0 0 0 0 0 0 0 0 
+0 30271.7 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000080 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+19621 0 19559.4 0 0 0 0 0 0 0 
+0 19559.4 0 19559.4 0 0 0 0 0 0 
+14993.9 14993.9 19577.6 0 0 0 0 0 0 19512.1 
+0 14993.9 0 0 0 0 0 0 0 0 
+14998.4 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000090 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+12521.9 0 12520.7 12561.4 0 0 0 0 0 12257.7 
+12216.9 12521.9 12521.9 12521.9 12521.9 0 0 0 0 12216.9 
+11641.3 12521.9 12521.9 12521.9 0 0 0 0 12257.7 11637.8 
+11639 12071.5 11648.3 12065.8 12561.4 12561.4 0 0 11641.3 18755.1 
+11634.3 12533.8 10947.4 11648.3 12051.1 0 0 0 0 11639 
+11649.5 0 10952.9 0 0 0 0 0 0 11649.5 
+0 12533.8 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
+deme_0000001_energy_0000100 = [ ...
+0 0 0 10292.9 0 0 0 0 0 0 
+10981.7 10391.9 11017.4 11016.3 10327.3 0 0 0 10631.8 0 
+11016.3 11053.1 10630.7 10361.8 11016.3 0 0 10863.4 10631.8 10667.2 
+10631.8 10631.8 10361.8 11016.3 11016.3 11016.3 10686.2 10631.8 10863.4 10596.4 
+10889.3 10631.8 10981.7 11016.3 11016.3 10981.7 0 10699.1 10664.8 10596.4 
+10892.5 10207.2 10233.1 10213.7 10227.2 0 0 10990.9 10990.9 10909.2 
+10901.6 10990.9 10207.2 10990.9 11627.4 10217.9 0 0 10990.9 10907.1 
+10990.9 10885.2 10207.2 10197.9 10990.9 0 0 0 10989.8 11022.2 
+0 10986.5 0 10206.2 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+
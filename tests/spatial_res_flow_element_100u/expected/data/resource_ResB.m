@@ -0,0 +1,132 @@
+ResB0000000 = [ ...
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 5 4 4 4 4 4 
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 4 4 4 5 4 5 
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 4 4 4 4 4 4 
+4 4 4 4 4 4 4 4 4 4 
+5 4 4 4 4 4 4 5 4 4 
+];
+ResB0000010 = [ ...
+1.56927 1.60189 1.39453 1.24641 1.31569 1.51432 1.60706 1.55453 1.51136 1.47638 
+1.48751 0.644009 0.63069 1.60259 0.556399 1.53729 0.47527 1.3599 1.35891 1.34777 
+0.465434 0.643207 0.628989 1.66452 1.75428 0.713398 1.46419 1.09867 1.19258 1.3182 
+1.61626 1.70625 0.547228 1.47198 1.68191 0.62809 1.39951 1.06175 1.02944 1.37003 
+1.48374 1.61862 1.50941 1.28179 1.44429 0.618476 1.48077 1.28279 1.17521 1.26707 
+1.40609 1.52538 0.580516 1.48094 0.433442 1.60937 1.57712 1.32814 1.14987 1.24455 
+1.27122 1.42773 0.546905 1.57994 1.53577 1.51421 1.4324 1.30419 1.15172 0.082413 
+1.25874 1.3394 1.48589 1.55023 1.51047 1.41432 1.3129 0.2836 1.37822 1.28209 
+1.31725 1.26264 1.25475 1.4135 1.48928 1.48478 0.452971 1.47113 1.50662 1.39612 
+1.62134 0.463254 0.124754 1.1848 1.41464 0.563825 1.55976 1.53933 1.54127 1.58265 
+];
+ResB0000020 = [ ...
+0.0915727 0.0936052 0.0803905 0.0666297 0.068575 0 0.0382166 0.0449106 0.0620385 0.0723846 
+0.0983137 0.113 0 0.123202 0 0 0.0748022 0 0.0593313 0.0792468 
+0.088706 0.101486 0.123127 0.135033 0.130643 0.117142 0.12415 0 0.0587012 0.0720352 
+0.0857391 0.0984484 0.120563 0.11495 0.121373 0.145345 0.15174 0 0 0.0729247 
+0.0960516 0 0.119261 0.10059 0.0871625 0.112741 0 0 0.063795 0.0786792 
+0.112793 0.125874 0.125831 0.113748 0 0.094512 0.100701 0.0854303 0.067568 0 
+0 0.128275 0.129355 0.120175 0.0904125 0.0802256 0.0842428 0 0.0690597 0.0849134 
+0.0922583 0.107922 0.115911 0.118208 0.098834 0.0853275 0.0853419 0.0736894 0.0538339 0.0651805 
+0.0725347 0.0804004 0.0833841 0.0923644 0.0957969 0.0922372 0.0897304 0.0725388 0.051701 0.0519068 
+0.0792675 0.0752131 0.06499 0.0668266 0.0814513 0.0645457 0.0565266 0.0558736 0.0548025 0.0640257 
+];
+ResB0000030 = [ ...
+0.0105171 0.00963598 0.00790675 0.00513014 0.004314 0.00499596 0.00470303 0.00513477 0.00724005 0.00930214 
+0.00822927 0.00750198 0.00631554 0.00543908 0 0.006035 0.00681437 0.00700168 0.0070955 0.00759815 
+0.00646693 0.00636046 0.00637606 0.00613983 0 0 0.0061458 0.00686602 0 0.00651642 
+0.00601059 0 0.00644834 0.00589128 0.00475148 0.00515209 0.00623927 0.0070201 0 0.00632242 
+0.005828 0 0.00554912 0.00517849 0.00507589 0.00512117 0.00563974 0 0 0.00654644 
+0.0056174 0.00664631 0.00596137 0.00490054 0.00695059 0.00702319 0.00481595 0.00483435 0 0.0069973 
+0.00627069 0.00638522 0.00799499 0.00637996 0.00614342 0 0.00426898 0.00313397 0.00575758 0.00807605 
+0.00851775 0.00729484 0.00813387 0.00754441 0.00570497 0.00645682 0.00654455 0.00569396 0.00683071 0.00899318 
+0.0108068 0.00883336 0.00676901 0.00626037 0.00584538 0.00508338 0.00580303 0.00741739 0.00942237 0.0107348 
+0.0115254 0.00937339 0.00603597 0.00359776 0.00383853 0 0.00382989 0.00588869 0 0.0107353 
+];
+ResB0000040 = [ ...
+0 0.000802383 0.000803468 0.000832222 0.000776873 0.000751457 0 0.000866632 0.000971096 0.000860309 
+0.000640695 0.000608302 0.000689034 0.000843006 0 0 0.000615427 0.000770001 0.000858024 0.000822484 
+0.000657255 0.000516156 0.000579684 0.000727906 0 0 0.000741523 0.000880558 0.000921577 0.00086599 
+0.00065729 0.000474726 0.000465341 0.0005787 0.000687089 0 0.000823134 0 0 0.00083749 
+0.000545732 0.000446614 0.000437223 0.000482386 0 0.000684321 0.000749526 0 0 0.00069796 
+0.000475439 0.000349399 0 0.000463533 0.00055954 0 0.000685801 0.00073253 0.000726026 0.000662127 
+0.000591771 0.000499714 0.000492534 0.000525816 0 0.000723483 0.00068928 0.00070255 0.000781117 0 
+0.000781475 0.000663546 0.000613584 0.000627013 0.000689025 0.000806582 0.000815691 0.00069445 0.00079084 0.000839056 
+0.000958281 0.000863672 0.000751785 0.000717855 0.000788285 0.000901973 0.00102054 0.000901348 0 0.000941693 
+0.000933053 0.000908754 0.000810836 0.000784513 0.000798161 0.000907146 0 0.000905635 0.000803075 0 
+];
+ResB0000050 = [ ...
+7.22836e-05 8.42764e-05 7.26157e-05 7.10991e-05 9.60407e-05 0.000133399 0.000159346 0 0 7.3882e-05 
+0 7.89731e-05 7.50761e-05 6.79506e-05 0 0.000102746 0.000125687 0 0.000107371 0 
+0 8.36696e-05 7.68266e-05 6.16194e-05 6.04305e-05 7.64902e-05 0 0.000105515 0 7.44087e-05 
+6.55819e-05 6.21363e-05 6.70521e-05 5.7405e-05 4.95496e-05 6.13684e-05 0 0 9.59742e-05 8.3544e-05 
+5.2162e-05 4.19068e-05 4.60646e-05 5.42805e-05 6.21968e-05 6.93755e-05 7.95799e-05 8.91471e-05 0 7.16232e-05 
+4.64017e-05 3.52681e-05 3.23191e-05 3.90964e-05 5.91007e-05 7.23637e-05 8.24875e-05 8.95035e-05 8.3259e-05 6.29479e-05 
+4.81661e-05 4.69068e-05 4.35388e-05 3.1768e-05 4.14553e-05 7.19746e-05 9.70352e-05 9.76456e-05 8.01993e-05 5.69198e-05 
+6.22773e-05 6.48221e-05 7.07862e-05 5.40266e-05 4.03838e-05 7.68558e-05 0.000126182 0.000119781 8.47755e-05 6.55678e-05 
+0 7.85523e-05 7.41669e-05 6.89331e-05 6.83639e-05 9.99219e-05 0.000149446 0 9.938e-05 7.48328e-05 
+9.25327e-05 8.17479e-05 7.0416e-05 7.36439e-05 0.000102855 0.00014144 0.000170705 0.000178094 0.000140426 0.000100886 
+];
+ResB0000060 = [ ...
+7.45448e-06 9.51779e-06 1.18549e-05 1.41001e-05 1.46212e-05 0 1.06136e-05 8.85238e-06 6.34864e-06 5.8765e-06 
+8.10269e-06 1.06632e-05 1.14632e-05 1.22366e-05 1.22284e-05 1.08012e-05 9.17188e-06 7.31162e-06 4.08527e-06 0 
+7.56835e-06 0 8.92403e-06 9.21763e-06 8.61078e-06 8.2432e-06 7.94765e-06 6.62954e-06 0 4.03818e-06 
+5.74289e-06 6.48095e-06 5.75829e-06 6.27309e-06 5.97647e-06 6.08679e-06 0 5.80169e-06 4.29367e-06 4.67399e-06 
+4.92058e-06 4.2357e-06 3.87659e-06 4.53192e-06 5.02463e-06 5.376e-06 5.37512e-06 3.92795e-06 3.1467e-06 4.66495e-06 
+5.01692e-06 4.13793e-06 3.96667e-06 5.23411e-06 6.72669e-06 5.98257e-06 5.00668e-06 3.14644e-06 3.28432e-06 4.72728e-06 
+5.1753e-06 5.72719e-06 6.27173e-06 6.01503e-06 7.62301e-06 6.44174e-06 5.20989e-06 3.92201e-06 3.89322e-06 4.82515e-06 
+5.13282e-06 6.46858e-06 8.64293e-06 8.70027e-06 8.96691e-06 0 6.07953e-06 3.86594e-06 2.77109e-06 3.8319e-06 
+0 7.68719e-06 8.66866e-06 8.75687e-06 1.12472e-05 1.13882e-05 9.39017e-06 6.37201e-06 4.21069e-06 0 
+6.00034e-06 7.96126e-06 9.60935e-06 9.50285e-06 1.08078e-05 1.23892e-05 1.17919e-05 9.1502e-06 6.38242e-06 5.83636e-06 
+];
+ResB0000070 = [ ...
+1.02994e-06 0 1.36796e-06 1.24761e-06 1.10228e-06 1.00614e-06 1.12185e-06 7.75488e-07 5.06507e-07 4.92135e-07 
+9.15619e-07 1.64725e-06 0 0 1.18477e-06 0 8.39408e-07 6.02499e-07 4.37476e-07 4.10366e-07 
+0 0 1.81221e-06 1.6497e-06 0 9.61859e-07 7.19929e-07 4.71171e-07 4.39965e-07 7.71605e-07 
+0 1.52436e-06 1.45891e-06 1.32884e-06 1.18514e-06 8.76183e-07 0 3.34997e-07 3.32524e-07 0 
+9.3742e-07 1.01369e-06 9.99428e-07 9.65342e-07 0 8.88484e-07 6.65402e-07 3.23735e-07 3.41939e-07 6.82383e-07 
+5.34273e-07 6.12295e-07 6.77087e-07 0 7.49186e-07 7.88545e-07 7.25386e-07 3.68903e-07 1.7262e-07 3.44997e-07 
+4.13926e-07 5.01461e-07 0 6.44791e-07 6.35775e-07 6.82988e-07 8.15808e-07 6.47453e-07 3.03745e-07 2.68614e-07 
+4.8194e-07 4.84242e-07 5.44475e-07 6.23673e-07 0 6.77202e-07 8.51767e-07 0 0 5.16873e-07 
+6.89405e-07 5.57586e-07 6.52022e-07 8.02567e-07 8.64218e-07 8.90236e-07 1.02153e-06 1.04398e-06 9.9792e-07 8.54056e-07 
+8.64304e-07 8.53269e-07 8.25161e-07 9.84585e-07 9.93836e-07 1.08991e-06 1.17259e-06 9.70232e-07 8.03403e-07 7.95246e-07 
+];
+ResB0000080 = [ ...
+1.69462e-07 0 1.31727e-07 1.5657e-07 1.72492e-07 1.48884e-07 9.79816e-08 1.10815e-07 0 1.79477e-07 
+2.08107e-07 1.9196e-07 1.83011e-07 2.01081e-07 1.94813e-07 1.65464e-07 0 1.19197e-07 1.54044e-07 1.90615e-07 
+1.96426e-07 2.14866e-07 2.26251e-07 0 1.72675e-07 1.39138e-07 0 1.35952e-07 0 1.75381e-07 
+1.68356e-07 1.78462e-07 1.94496e-07 1.76445e-07 1.38414e-07 1.09283e-07 1.10132e-07 1.20986e-07 0 1.47379e-07 
+1.3711e-07 1.25623e-07 1.38223e-07 1.42705e-07 1.22484e-07 1.051e-07 1.07622e-07 0 1.10726e-07 1.16041e-07 
+1.14222e-07 8.64411e-08 7.71318e-08 9.67915e-08 1.13429e-07 1.13276e-07 1.16627e-07 1.07622e-07 9.16404e-08 8.82374e-08 
+1.03408e-07 8.23263e-08 6.46414e-08 7.21086e-08 9.86476e-08 1.16442e-07 0 1.03333e-07 8.31768e-08 0 
+0 8.40106e-08 7.1234e-08 0 8.89244e-08 0 1.05206e-07 9.70265e-08 8.64739e-08 8.28302e-08 
+8.51978e-08 8.80078e-08 9.21491e-08 1.14403e-07 1.21187e-07 1.15692e-07 0 8.92448e-08 1.06257e-07 1.11428e-07 
+1.10604e-07 9.40054e-08 1.15073e-07 1.33224e-07 1.50248e-07 1.23616e-07 8.53364e-08 9.34262e-08 1.22423e-07 1.46861e-07 
+];
+ResB0000090 = [ ...
+2.94856e-08 3.6527e-08 4.10409e-08 4.23093e-08 4.0586e-08 3.26123e-08 2.52759e-08 2.41289e-08 2.16643e-08 2.18572e-08 
+3.04599e-08 4.08982e-08 4.68883e-08 4.81108e-08 4.12815e-08 3.48011e-08 2.78778e-08 2.11477e-08 1.68622e-08 2.02564e-08 
+3.51899e-08 4.40064e-08 5.02455e-08 5.13529e-08 3.9931e-08 2.72969e-08 2.24003e-08 1.63995e-08 1.64933e-08 2.47754e-08 
+0 4.53402e-08 5.06991e-08 5.18052e-08 3.85378e-08 2.2017e-08 1.65352e-08 1.83519e-08 1.9995e-08 0 
+3.45318e-08 4.198e-08 4.72294e-08 4.89372e-08 3.89913e-08 2.70168e-08 2.10493e-08 1.96746e-08 2.12402e-08 2.65121e-08 
+3.08749e-08 3.59013e-08 4.05264e-08 4.27015e-08 3.57822e-08 2.76616e-08 2.60081e-08 2.46978e-08 2.36492e-08 2.641e-08 
+2.61908e-08 2.9224e-08 3.29052e-08 3.47466e-08 3.39184e-08 3.13742e-08 2.81627e-08 2.5301e-08 0 2.44432e-08 
+2.43237e-08 2.58307e-08 2.81948e-08 2.89511e-08 2.78828e-08 2.51714e-08 2.58337e-08 2.56443e-08 2.51083e-08 2.4075e-08 
+2.59337e-08 2.71782e-08 2.88494e-08 2.90123e-08 2.76724e-08 0 2.18937e-08 2.64841e-08 2.75833e-08 2.60494e-08 
+2.7775e-08 3.16425e-08 3.41887e-08 3.47636e-08 0 2.32017e-08 1.95089e-08 2.61264e-08 2.6616e-08 2.5921e-08 
+];
+ResB0000100 = [ ...
+1.29726e-08 1.5023e-08 1.52411e-08 1.45737e-08 1.25501e-08 1.17743e-08 1.07933e-08 8.59106e-09 6.59383e-09 9.00232e-09 
+1.323e-08 1.56665e-08 1.5986e-08 1.53374e-08 1.20993e-08 1.04775e-08 1.05878e-08 8.99718e-09 7.19176e-09 9.09309e-09 
+1.49153e-08 1.61506e-08 1.64608e-08 1.58509e-08 1.29347e-08 1.02212e-08 1.00416e-08 1.05673e-08 1.13759e-08 1.31177e-08 
+0 1.6286e-08 1.65676e-08 1.6032e-08 1.48542e-08 1.31395e-08 1.13891e-08 1.09073e-08 1.21109e-08 1.38969e-08 
+1.51271e-08 1.59544e-08 1.62229e-08 1.57799e-08 1.46324e-08 1.30872e-08 1.15385e-08 1.10057e-08 1.2013e-08 1.37399e-08 
+1.3484e-08 1.45212e-08 1.53634e-08 1.49813e-08 1.37379e-08 1.22477e-08 1.12706e-08 1.11842e-08 1.20177e-08 1.22238e-08 
+1.11729e-08 1.3394e-08 1.43116e-08 1.37803e-08 1.22955e-08 1.07464e-08 9.53097e-09 1.01968e-08 1.12951e-08 1.05705e-08 
+1.01172e-08 1.22439e-08 1.35854e-08 1.27826e-08 1.10883e-08 8.87899e-09 7.38863e-09 8.15125e-09 1.05491e-08 1.02099e-08 
+1.26674e-08 1.35287e-08 1.36049e-08 1.27092e-08 1.11559e-08 8.48928e-09 6.88822e-09 7.49929e-09 9.44543e-09 1.1334e-08 
+1.25624e-08 1.42126e-08 1.43176e-08 1.3535e-08 1.23676e-08 1.02135e-08 8.7574e-09 8.50208e-09 8.55411e-09 1.00863e-08 
+];
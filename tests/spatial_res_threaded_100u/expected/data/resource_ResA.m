@@ -0,0 +1,132 @@
+ResA0000000 = [ ...
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+11 11 11 11 11 11 11 11 11 11 
+];
+ResA0000010 = [ ...
+40.5584 52.5108 58.4854 59.0848 53.7003 33.8199 23.1289 18.1477 16.7433 23.3724 
+32.8251 42.3037 48.1416 49.351 44.5216 29.6741 19.3966 14.8789 14.7657 19.3438 
+30.5159 39.9411 44.5563 45.6864 41.6616 26.0413 17.7619 13.0295 12.7658 17.8316 
+29.4855 37.162 40.0969 41.7186 37.9342 23.6413 15.5613 11.9984 11.907 16.9259 
+23.9337 28.3086 32.4302 33.1864 30.3008 17.432 12.2365 9.30056 9.59048 13.9874 
+8.43565 12.7482 14.218 15.1591 13.7382 9.13172 6.0399 5.66015 5.39487 7.22103 
+5.26548 7.59582 8.48551 10.3581 8.73867 5.65028 4.78771 3.98818 4.30106 5.25837 
+4.07351 6.14601 7.71128 7.41687 7.92684 5.56159 4.01311 2.42551 3.85988 5.81155 
+2.77014 5.2714 6.06073 6.84412 6.65709 4.73441 2.56203 3.09337 3.45686 5.21915 
+3.05324 3.78332 4.57983 4.80436 5.06464 2.62482 2.68589 2.33365 2.61895 2.6982 
+];
+ResA0000020 = [ ...
+60.2168 82.2812 97.4665 102.919 96.9616 70.5128 50.1298 36.58 31.8921 40.6888 
+46.5712 64.5167 75.2956 80.2911 74.8324 55.4612 40.7947 29.3025 25.3498 31.9819 
+41.6948 55.7907 65.014 68.5492 64.4973 47.1766 32.4854 23.9532 20.4107 26.3667 
+36.7158 47.801 55.1037 57.8205 53.6719 37.7572 25.0729 18.2204 14.9711 19.1326 
+27.925 34.3693 40.5383 42.4083 39.2502 25.6757 16.3388 11.7485 9.76548 13.0481 
+9.15667 13.298 17.7754 19.1532 17.2185 11.9307 7.89381 5.47837 4.46072 4.71422 
+3.08428 5.77495 7.90892 8.9945 8.39237 5.31704 2.78011 1.71326 2.12961 2.38519 
+1.58605 2.8031 4.06181 4.7501 4.48477 2.96918 1.8679 0.331653 1.00284 0.718164 
+0.914858 1.45363 2.13348 2.56681 2.54096 1.62613 0.938394 0.586973 0.554637 0.803757 
+0.606189 0.10412 0.323016 1.53631 1.43468 0.859853 0.265371 0.25529 0.227176 0.216187 
+];
+ResA0000030 = [ ...
+75.6887 105.423 127.147 138.564 135.565 109.337 85.3708 66.9858 59.3626 74.7448 
+56.8913 78.7619 95.1605 103.827 100.467 82.4559 64.3809 50.8875 44.5439 54.7631 
+47.9899 65.0633 77.6745 84.159 80.6501 63.2102 49.2994 38.4906 32.6708 41.7001 
+40.4029 52.6888 62.9554 67.5056 64.3622 48.4979 36.2057 27.3295 23.2787 29.0515 
+29.6992 37.263 44.6035 47.1915 44.2463 32.1016 22.7937 15.7915 13.3496 16.5873 
+9.61043 14.9663 17.9505 19.8601 18.8965 13.9575 9.37845 6.40926 4.87091 5.05677 
+3.37394 5.29263 7.2924 8.63178 8.11438 4.85033 4.00731 2.31011 1.48747 1.56883 
+0 1.70852 2.5877 3.16519 3.22452 2.24345 1.49675 0.99039 0 0 
+0.217372 0.392065 0.408288 0.866197 0.977937 0.475247 0.400491 0.284827 0 0.319856 
+0.0929326 0.177406 0.255841 0.211493 0.122385 0 0 0.0623675 0.0417919 0 
+];
+ResA0000040 = [ ...
+84.5421 120.476 148.477 166 167.402 143.183 119.091 101.835 98.3802 130.96 
+63.0826 88.6919 108.644 121.192 120.855 104.321 87.362 73.6387 71.374 92.4664 
+51.9109 71.0935 86.0842 94.8613 93.4825 77.6123 64.1766 52.9341 50.5524 66.5947 
+42.7261 57.1899 67.6776 73.7978 72.5051 56.5727 43.3945 35.7752 33.4171 43.8701 
+31.1269 39.9319 47.0164 50.9959 48.6455 36.7443 27.7879 19.932 18.6806 24.606 
+10.0872 15.7978 19.0845 22.6295 21.8444 15.5002 11.4085 8.3605 6.33363 8.15248 
+3.6498 5.84066 7.77936 7.07447 7.89039 6.36341 4.36453 2.46782 1.9226 1.21123 
+1.04701 1.7763 2.58652 3.06221 3.08478 2.2781 1.5774 1.0372 0.38597 0.463783 
+0.230443 0.431566 0.364853 0.642388 0.867119 0.727304 0.529847 0.336826 0 0.0587569 
+0.0534775 0.109436 0.0627975 0.122125 0.240819 0.231269 0 0.093168 0 0 
+];
+ResA0000050 = [ ...
+92.7721 132.656 164.815 186.888 192.264 171.115 152.385 138.137 145.056 207.635 
+66.6372 96.0966 119.224 134.343 136.78 123.168 108.619 98.5731 104.659 141.788 
+53.973 75.9032 92.5133 103.09 104.291 89.9901 76.7332 69.9169 71.4307 99.0045 
+44.6356 60.0585 71.6965 78.6863 78.3943 64.457 52.2731 45.9171 46.7736 63.1123 
+32.1822 41.6326 49.1098 53.6829 52.8207 40.2912 31.738 26.3729 25.4401 34.2456 
+10.4138 16.4748 20.809 23.8313 23.2262 16.8904 12.6357 10.039 9.47499 11.2435 
+3.1998 5.71956 8.18735 9.60352 8.91543 6.52618 4.64685 3.0617 2.578 3.05735 
+0.767904 1.55726 2.62167 3.24056 2.94698 1.74157 1.10405 0.70978 0.412149 0.254048 
+0.0927843 0.403599 0.625404 0.635127 0.554522 0.432125 0.407009 0 0.26227 0.237478 
+0.0626277 0.0803635 0.136748 0.0990334 0.0687225 0.146962 0 0 0.138044 0.0449894 
+];
+ResA0000060 = [ ...
+98.04 140.918 177.186 202.744 211.346 195.469 181.386 175.373 198.554 298.806 
+71.0869 101.294 126.815 144.725 149.879 139.173 127.874 124.079 139.988 199.66 
+55.5186 77.9595 97.0175 109.436 111.534 100.012 89.597 85.3322 93.7016 134.473 
+45.6293 61.7787 74.3936 82.3409 83.0244 69.5475 59.6009 54.7469 59.2957 84.2678 
+32.7612 42.5241 50.5944 54.8886 54.4933 43.2475 34.9936 30.771 31.9688 44.2828 
+10.6902 16.884 21.75 24.6204 24.7629 18.4367 14.0007 11.6637 11.4108 14.3445 
+3.48529 5.83346 8.36813 10.1719 9.81524 7.41133 5.11829 3.62973 3.39467 4.17599 
+0.812965 1.67639 2.63368 3.40071 3.63673 2.32146 1.53703 1.26395 0.695695 0.428634 
+0.0891007 0.334121 0.585223 0.491317 0.57003 0.799547 0.626632 0.386023 0.166812 0.0246615 
+0.0378399 0.0608185 0.15817 0.238816 0.309449 0.247934 0.234358 0.162696 0.100265 0.0405597 
+];
+ResA0000070 = [ ...
+101.751 146.856 186.005 214.571 228.563 216.697 208.411 212.732 255.436 401.773 
+72.5541 104.824 132.582 151.72 160.199 152.004 145.044 148.431 177.699 263.966 
+56.7069 80.7446 100.94 114.664 118.679 108.318 100.204 100.229 117.49 173.35 
+45.5756 63.263 76.6939 85.4556 87.1482 74.2404 66.4369 64.192 73.1785 106.404 
+32.1134 43.4833 51.9458 57.4257 56.6671 46.2949 39.0698 35.5512 38.9509 55.9703 
+11.17 17.5131 22.4138 24.6781 25.6902 19.5829 15.7355 13.8009 14.1107 17.1231 
+3.76804 6.07518 8.1895 10.1633 10.2786 7.7345 6.00199 4.88594 4.58519 5.05362 
+1.05485 1.91988 2.7159 3.22111 3.1815 2.75714 2.11156 1.66481 1.34583 1.4934 
+0.19195 0.24938 0.342654 0.440857 0.794567 0.813995 0.765477 0 0.435316 0.256657 
+0.0806998 0.136087 0.210661 0 0 0.243465 0.268394 0.206999 0.076007 0.078748 
+];
+ResA0000080 = [ ...
+104.083 150.93 192.91 225.301 242.526 235.797 233.66 249.605 316.026 515.317 
+74.4614 108.38 137.098 159.166 170.314 164.854 162.124 173.563 217.419 331.534 
+59.8039 82.7676 103.954 118.463 124.968 116.416 110.775 116.741 142.863 216.762 
+47.6178 64.7287 78.6842 88.0502 90.9319 79.2761 73.5155 73.8962 87.215 131.731 
+33.5122 44.1416 52.7273 59.1236 58.8724 49.0216 42.163 40.3567 45.8442 68.6579 
+11.3557 17.8845 22.4448 26.1573 26.6093 19.6331 17.1248 15.6006 16.5577 21.0741 
+3.6084 5.93201 8.60334 10.3411 10.3395 8.20336 5.56971 5.31573 5.48231 5.81838 
+0 1.73443 2.45032 2.66278 3.65113 1.52411 2.13226 1.30469 1.33161 1.6988 
+0.314777 0.44052 0.856122 1.14268 0.222704 0.886813 0.362844 0.358725 0 0.49521 
+0.117145 0.0935076 0.309209 0.459234 0.463522 0.313918 0.11424 0.130687 0 0.188288 
+];
+ResA0000090 = [ ...
+106.918 154.949 198.533 233.648 254.486 252.709 258.256 287.946 380.218 635.466 
+76.8505 110.635 140.868 164.812 178.312 176.083 178.847 198.621 259.667 405.151 
+60.9408 85.5841 106.737 122.771 130.373 123.71 122.197 132.795 169.211 260.66 
+47.605 66.3282 80.8111 91.1133 94.3918 84.8328 79.6735 83.6817 103.702 157.624 
+34.4687 45.4964 54.749 61.0203 61.793 51.406 46.1984 46.2419 55.2214 82.4616 
+12.0886 18.8848 24.2131 27.7787 28.0188 21.731 18.5289 16.8111 20.1405 26.0571 
+4.37036 7.1349 9.73257 11.526 11.6744 8.97909 7.26269 6.5987 5.90987 8.37411 
+1.46192 2.48968 3.55069 4.30816 4.37077 3.26259 2.52123 2.19413 2.1712 2.53918 
+0.472634 0.832295 1.23853 1.54026 1.5043 0.726007 0.612857 0.538644 0.586792 0.704868 
+0.180365 0.336628 0.518884 0.620016 0.241522 0.334927 0.225859 0.189161 0.182893 0.221625 
+];
+ResA0000100 = [ ...
+109.456 158.753 204.029 241.226 265.068 268.112 281.747 325.903 445.513 761.07 
+78.5942 113.455 144.74 170.024 185.508 186.355 194.744 224.204 303.613 482.093 
+62.1505 87.4539 109.456 126.379 135.283 130.898 132.821 149.22 196.555 309.092 
+48.8379 67.572 82.6803 93.5881 97.7159 89.4013 86.1537 93.5181 119.879 185.571 
+35.1223 46.5072 56.1527 62.6717 64.0821 54.3358 49.8553 51.5264 63.5844 96.9092 
+12.6344 19.7596 25.4403 29.1387 29.248 22.9947 20.0426 19.7892 23.2248 30.759 
+4.27745 7.8223 10.8037 12.7012 12.8031 9.79631 7.96632 7.40395 7.07206 10.3669 
+1.81602 3.05752 4.37583 5.27162 5.33371 3.96368 3.06136 2.52289 2.65818 3.2333 
+0.735096 1.23633 1.77114 2.16668 2.19604 1.60618 1.05108 0.88205 0.82756 0.841338 
+0.33066 0.573634 0.82529 1.01506 1.03664 0.726922 0.52761 0.356266 0.23829 0.230859 
+];